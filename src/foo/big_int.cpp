@@ -0,0 +1,1169 @@
+#include "foo/big_int.hpp"
+#include "foo/int128.hpp"
+#include "foo/modular.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace cpp_concept
+{
+
+  namespace
+  {
+
+    using Limb = std::uint64_t;
+    using Multiplication = BigInt::Multiplication;
+
+    // Operand lengths in limbs from which each multiplication algorithm beats
+    // the one before it, measured by the BM_BigIntMultiply benchmarks
+    constexpr std::size_t karatsuba_threshold = 32;
+    constexpr std::size_t toom3_threshold = 128;
+    constexpr std::size_t ntt_threshold = 2048;
+
+    // Largest power of ten in a limb, so decimal output works in groups of 19 digits
+    constexpr Limb decimal_group = 10000000000000000000ULL;
+    constexpr int decimal_digits = 19;
+
+    // r[0, n) = a[0, n) + b[0, n); returns the carry out
+    Limb add_n(Limb *r, const Limb *a, const Limb *b, std::size_t n) noexcept
+    {
+      Limb carry = 0;
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        const uint128_t sum = uint128_t{a[i]} + b[i] + carry;
+        r[i] = static_cast<Limb>(sum);
+        carry = static_cast<Limb>(sum >> 64);
+      }
+
+      return carry;
+    }
+
+    // r[0, n) = a[0, n) - b[0, n); returns the borrow out
+    Limb sub_n(Limb *r, const Limb *a, const Limb *b, std::size_t n) noexcept
+    {
+      Limb borrow = 0;
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        const Limb ai = a[i];
+        const Limb d = ai - b[i];
+        const Limb out = d - borrow;
+        borrow = static_cast<Limb>(ai < b[i]) | static_cast<Limb>(d < borrow);
+        r[i] = out;
+      }
+
+      return borrow;
+    }
+
+    // r[0, rn) += b[0, bn) for bn <= rn; returns the carry out of r
+    Limb add_into(Limb *r, std::size_t rn, const Limb *b, std::size_t bn) noexcept
+    {
+      Limb carry = add_n(r, r, b, bn);
+      for (std::size_t i = bn; carry != 0 && i < rn; ++i)
+      {
+        carry = ++r[i] == 0 ? 1 : 0;
+      }
+
+      return carry;
+    }
+
+    // r[0, rn) -= b[0, bn) for bn <= rn; returns the borrow out of r
+    Limb sub_from(Limb *r, std::size_t rn, const Limb *b, std::size_t bn) noexcept
+    {
+      Limb borrow = sub_n(r, r, b, bn);
+      for (std::size_t i = bn; borrow != 0 && i < rn; ++i)
+      {
+        borrow = r[i]-- == 0 ? 1 : 0;
+      }
+
+      return borrow;
+    }
+
+    // r[0, n) = a[0, n) * m + r[0, n); returns the high limb
+    Limb add_mul_1(Limb *r, const Limb *a, std::size_t n, Limb m) noexcept
+    {
+      Limb carry = 0;
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        const uint128_t t = uint128_t{a[i]} * m + r[i] + carry;
+        r[i] = static_cast<Limb>(t);
+        carry = static_cast<Limb>(t >> 64);
+      }
+
+      return carry;
+    }
+
+    // out[0, na + nb) = a * b
+    void mul_schoolbook(const Limb *a, std::size_t na, const Limb *b, std::size_t nb, Limb *out) noexcept
+    {
+      std::fill_n(out, na + nb, Limb{0});
+      for (std::size_t j = 0; j < nb; ++j)
+      {
+        out[na + j] = add_mul_1(out + j, a, na, b[j]);
+      }
+    }
+
+    // out[0, 2n) = a^2, computing each cross product a_i * a_j once and doubling
+    void sqr_schoolbook(const Limb *a, std::size_t n, Limb *out) noexcept
+    {
+      std::fill_n(out, 2 * n, Limb{0});
+      for (std::size_t i = 1; i < n; ++i)
+      {
+        out[2 * i - 1 + (n - i)] = add_mul_1(out + 2 * i - 1, a + i, n - i, a[i - 1]);
+      }
+
+      Limb carry = 0;
+      for (std::size_t i = 0; i < 2 * n; ++i)
+      {
+        const Limb next = out[i] >> 63;
+        out[i] = (out[i] << 1) | carry;
+        carry = next;
+      }
+
+      carry = 0;
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        const uint128_t d = uint128_t{a[i]} * a[i];
+        const uint128_t lo = uint128_t{out[2 * i]} + static_cast<Limb>(d) + carry;
+        out[2 * i] = static_cast<Limb>(lo);
+        const uint128_t hi = uint128_t{out[2 * i + 1]} + static_cast<Limb>(d >> 64) + static_cast<Limb>(lo >> 64);
+        out[2 * i + 1] = static_cast<Limb>(hi);
+        carry = static_cast<Limb>(hi >> 64);
+      }
+    }
+
+    // Scratch limbs needed by multiply_square() for operands of up to n limbs:
+    // the larger of a Karatsuba and a Toom-3 step plus what their parts need
+    std::size_t multiply_scratch(std::size_t n) noexcept
+    {
+      if (n < 2)
+      {
+        return 0;
+      }
+
+      const std::size_t half = n - n / 2;
+      const std::size_t third = (n + 2) / 3;
+
+      return std::max(4 * half + 2, 12 * third + 12) + multiply_scratch(half);
+    }
+
+    void multiply_square(const Limb *a, const Limb *b, std::size_t n, Limb *out, Limb *scratch,
+                         Multiplication algorithm) noexcept;
+
+    // out[0, 2n) = a[0, n) * b[0, n) for n >= 2. Splits at m = ceil(n / 2) and
+    // forms (a0 + a1)(b0 + b1) on m limbs, folding the carries of the two sums
+    // back in afterwards, so every recursive product stays square
+    void karatsuba(const Limb *a, const Limb *b, std::size_t n, Limb *out, Limb *scratch) noexcept
+    {
+      const std::size_t m = n - n / 2;
+      const std::size_t k = n / 2;
+      Limb *sa = scratch;
+      Limb *sb = sa + m;
+      Limb *mid = sb + m;
+      Limb *next = mid + 2 * m + 2;
+
+      // z0 = a0 * b0 and z2 = a1 * b1 land directly in the two halves of out
+      multiply_square(a, b, m, out, next, Multiplication::automatic);
+      multiply_square(a + m, b + m, k, out + 2 * m, next, Multiplication::automatic);
+
+      std::copy_n(a, m, sa);
+      std::copy_n(b, m, sb);
+      const Limb ca = add_into(sa, m, a + m, k);
+      const Limb cb = add_into(sb, m, b + m, k);
+
+      // mid = (sa + ca B^m)(sb + cb B^m) = sa sb + (ca sb + cb sa) B^m + ca cb B^2m
+      multiply_square(sa, sb, m, mid, next, Multiplication::automatic);
+      mid[2 * m] = ca & cb;
+      mid[2 * m + 1] = 0;
+      if (ca != 0)
+      {
+        add_into(mid + m, m + 2, sb, m);
+      }
+      if (cb != 0)
+      {
+        add_into(mid + m, m + 2, sa, m);
+      }
+
+      sub_from(mid, 2 * m + 2, out, 2 * m);
+      sub_from(mid, 2 * m + 2, out + 2 * m, 2 * k);
+      add_into(out + m, 2 * n - m, mid, std::min(2 * m + 2, 2 * n - m));
+    }
+
+    // out[0, 2n) = a[0, n)^2 by the same split as karatsuba()
+    void karatsuba_square(const Limb *a, std::size_t n, Limb *out, Limb *scratch) noexcept
+    {
+      const std::size_t m = n - n / 2;
+      const std::size_t k = n / 2;
+      Limb *sa = scratch;
+      Limb *mid = sa + m;
+      Limb *next = mid + 2 * m + 2;
+
+      multiply_square(a, a, m, out, next, Multiplication::automatic);
+      multiply_square(a + m, a + m, k, out + 2 * m, next, Multiplication::automatic);
+
+      std::copy_n(a, m, sa);
+      const Limb ca = add_into(sa, m, a + m, k);
+
+      // mid = (sa + ca B^m)^2 = sa^2 + 2 ca sa B^m + ca B^2m
+      multiply_square(sa, sa, m, mid, next, Multiplication::automatic);
+      mid[2 * m] = ca;
+      mid[2 * m + 1] = 0;
+      if (ca != 0)
+      {
+        add_into(mid + m, m + 2, sa, m);
+        add_into(mid + m, m + 2, sa, m);
+      }
+
+      sub_from(mid, 2 * m + 2, out, 2 * m);
+      sub_from(mid, 2 * m + 2, out + 2 * m, 2 * k);
+      add_into(out + m, 2 * n - m, mid, std::min(2 * m + 2, 2 * n - m));
+    }
+
+    // Compares a[0, n) with b[0, n)
+    int compare_n(const Limb *a, const Limb *b, std::size_t n) noexcept
+    {
+      for (std::size_t i = n; i-- > 0;)
+      {
+        if (a[i] != b[i])
+        {
+          return a[i] < b[i] ? -1 : 1;
+        }
+      }
+
+      return 0;
+    }
+
+    // x[0, n) <<= 1; the value must stay below 2^(64n)
+    void shift_left_1(Limb *x, std::size_t n) noexcept
+    {
+      for (std::size_t i = n; i-- > 1;)
+      {
+        x[i] = (x[i] << 1) | (x[i - 1] >> 63);
+      }
+      x[0] <<= 1;
+    }
+
+    // x[0, n) >>= 1 as a two's complement value, so the sign is kept
+    void shift_right_1(Limb *x, std::size_t n) noexcept
+    {
+      for (std::size_t i = 0; i + 1 < n; ++i)
+      {
+        x[i] = (x[i] >> 1) | (x[i + 1] << 63);
+      }
+      x[n - 1] = static_cast<Limb>(static_cast<std::int64_t>(x[n - 1]) >> 1);
+    }
+
+    // x[0, n) = -x[0, n) in two's complement
+    void negate(Limb *x, std::size_t n) noexcept
+    {
+      Limb carry = 1;
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        x[i] = ~x[i] + carry;
+        carry &= static_cast<Limb>(x[i] == 0);
+      }
+    }
+
+    // x[0, n) /= 3 for x divisible by 3, as a two's complement value. Each
+    // quotient limb is the low limb times 3^-1 mod 2^64, and the high limb of
+    // three times it is borrowed from the rest
+    void divide_exact_3(Limb *x, std::size_t n) noexcept
+    {
+      constexpr Limb inverse_3 = 0xAAAAAAAAAAAAAAABULL;
+
+      Limb borrow = 0;
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        const Limb under = static_cast<Limb>(x[i] < borrow);
+        const Limb q = (x[i] - borrow) * inverse_3;
+        x[i] = q;
+        borrow = static_cast<Limb>((uint128_t{q} * 3) >> 64) + under;
+      }
+    }
+
+    // Evaluates x0 + x1 t + x2 t^2 at t = 1, -1 and 2, for x0 and x1 of k limbs
+    // and x2 of r <= k limbs, into k + 1 limbs each. The value at -1 is stored
+    // as its magnitude; returns whether it is negative
+    bool toom3_evaluate(const Limb *x, std::size_t k, std::size_t r, Limb *at_one, Limb *at_minus_one,
+                        Limb *at_two) noexcept
+    {
+      // at_one holds x0 + x2 until x1 is added last
+      std::copy_n(x, k, at_one);
+      at_one[k] = add_into(at_one, k, x + 2 * k, r);
+
+      const bool negative = at_one[k] == 0 && compare_n(at_one, x + k, k) < 0;
+      if (negative)
+      {
+        sub_n(at_minus_one, x + k, at_one, k);
+        at_minus_one[k] = 0;
+      }
+      else
+      {
+        std::copy_n(at_one, k + 1, at_minus_one);
+        sub_from(at_minus_one, k + 1, x + k, k);
+      }
+      add_into(at_one, k + 1, x + k, k);
+
+      // ((x2 * 2) + x1) * 2 + x0
+      std::copy_n(x + 2 * k, r, at_two);
+      std::fill_n(at_two + r, k + 1 - r, Limb{0});
+      shift_left_1(at_two, k + 1);
+      add_into(at_two, k + 1, x + k, k);
+      shift_left_1(at_two, k + 1);
+      add_into(at_two, k + 1, x, k);
+
+      return negative;
+    }
+
+    // out[0, 2n) = a[0, n) * b[0, n) for n >= 5 by Toom-Cook 3-way. Splits
+    // into thirds of k = ceil(n / 3) limbs, multiplies the values at 0, 1, -1,
+    // 2 and infinity recursively and interpolates with Bodrato's sequence. The
+    // interpolation runs in two's complement on 2k + 2 limbs, which hold the
+    // intermediate values, some of them negative, with room to spare
+    void toom3(const Limb *a, const Limb *b, std::size_t n, Limb *out, Limb *scratch) noexcept
+    {
+      const std::size_t k = (n + 2) / 3;
+      const std::size_t r = n - 2 * k;
+      const std::size_t w = 2 * k + 2;
+      const bool squaring = a == b;
+
+      Limb *a_one = scratch;
+      Limb *a_minus_one = a_one + (k + 1);
+      Limb *a_two = a_minus_one + (k + 1);
+      Limb *b_one = a_two + (k + 1);
+      Limb *b_minus_one = b_one + (k + 1);
+      Limb *b_two = b_minus_one + (k + 1);
+      Limb *v_one = b_two + (k + 1);
+      Limb *v_minus_one = v_one + w;
+      Limb *v_two = v_minus_one + w;
+      Limb *next = v_two + w;
+
+      const bool a_negative = toom3_evaluate(a, k, r, a_one, a_minus_one, a_two);
+      bool b_negative = a_negative;
+      if (squaring)
+      {
+        b_one = a_one;
+        b_minus_one = a_minus_one;
+        b_two = a_two;
+      }
+      else
+      {
+        b_negative = toom3_evaluate(b, k, r, b_one, b_minus_one, b_two);
+      }
+
+      // The values at 0 and infinity land directly in the low and high parts of out
+      constexpr auto automatic = Multiplication::automatic;
+      multiply_square(a, b, k, out, next, automatic);
+      multiply_square(a + 2 * k, b + 2 * k, r, out + 4 * k, next, automatic);
+      multiply_square(a_one, b_one, k + 1, v_one, next, automatic);
+      multiply_square(a_minus_one, b_minus_one, k + 1, v_minus_one, next, automatic);
+      multiply_square(a_two, b_two, k + 1, v_two, next, automatic);
+      if (a_negative != b_negative)
+      {
+        negate(v_minus_one, w);
+      }
+
+      // With the product c0 + c1 t + ... + c4 t^4 and c0, c4 known:
+      // T = (v(2) - v(-1)) / 3 = c1 + c2 + 3 c3 + 5 c4
+      sub_n(v_two, v_two, v_minus_one, w);
+      divide_exact_3(v_two, w);
+      // U = (v(1) - v(-1)) / 2 = c1 + c3
+      sub_n(v_one, v_one, v_minus_one, w);
+      shift_right_1(v_one, w);
+      // V = v(-1) - c0 = c2 + c4 - c1 - c3
+      sub_from(v_minus_one, w, out, 2 * k);
+      // c3 = (T - V) / 2 - U - 2 c4
+      sub_n(v_two, v_two, v_minus_one, w);
+      shift_right_1(v_two, w);
+      sub_n(v_two, v_two, v_one, w);
+      sub_from(v_two, w, out + 4 * k, 2 * r);
+      sub_from(v_two, w, out + 4 * k, 2 * r);
+      // c2 = V + U - c4
+      add_n(v_minus_one, v_minus_one, v_one, w);
+      sub_from(v_minus_one, w, out + 4 * k, 2 * r);
+      // c1 = U - c3
+      sub_n(v_one, v_one, v_two, w);
+
+      // Each coefficient is non-negative and fits below the end of out, so any
+      // limbs cut off there are zero
+      std::fill_n(out + 2 * k, 2 * k, Limb{0});
+      add_into(out + k, 2 * n - k, v_one, std::min(w, 2 * n - k));
+      add_into(out + 2 * k, 2 * n - 2 * k, v_minus_one, std::min(w, 2 * n - 2 * k));
+      add_into(out + 3 * k, 2 * n - 3 * k, v_two, std::min(w, 2 * n - 3 * k));
+    }
+
+    // out[0, 2n) = a[0, n) * b[0, n) with the given algorithm at this level,
+    // squaring when a and b are the same operand
+    void multiply_square(const Limb *a, const Limb *b, std::size_t n, Limb *out, Limb *scratch,
+                         Multiplication algorithm) noexcept
+    {
+      if (algorithm == Multiplication::automatic)
+      {
+        algorithm = n < karatsuba_threshold ? Multiplication::schoolbook
+                    : n < toom3_threshold   ? Multiplication::karatsuba
+                                            : Multiplication::toom3;
+      }
+      if ((algorithm == Multiplication::karatsuba && n < 2) || (algorithm == Multiplication::toom3 && n < 5))
+      {
+        algorithm = Multiplication::schoolbook;
+      }
+
+      if (algorithm == Multiplication::toom3)
+      {
+        toom3(a, b, n, out, scratch);
+      }
+      else if (algorithm == Multiplication::karatsuba)
+      {
+        a == b ? karatsuba_square(a, n, out, scratch) : karatsuba(a, b, n, out, scratch);
+      }
+      else
+      {
+        a == b ? sqr_schoolbook(a, n, out) : mul_schoolbook(a, n, b, n, out);
+      }
+    }
+
+    // Three primes c 2^k + 1 below 2^62, k >= 55, with a primitive root of
+    // each. Convolution terms of 64-bit limbs stay below 2^(128 + 55), under
+    // the product of the primes, so Garner's algorithm recovers them exactly
+    struct NttPrime
+    {
+      Limb modulus;
+      Limb root;
+    };
+
+    constexpr std::array<NttPrime, 3> ntt_primes = {{
+        {1945555039024054273ULL, 5}, // 27 * 2^56 + 1
+        {2485986994308513793ULL, 5}, // 69 * 2^55 + 1
+        {4179340454199820289ULL, 3}, // 29 * 2^57 + 1
+    }};
+
+    // Number-theoretic transform of a fixed power-of-two size modulo one
+    // prime, on values in Montgomery form
+    class Ntt
+    {
+    public:
+      Ntt(const NttPrime &prime, std::size_t size)
+          : mont_(prime.modulus), size_(size), roots_(size), inverse_roots_(size)
+      {
+        // roots_[len + j] = w^j for the primitive 2len-th root of unity w, one
+        // run per butterfly length; inverse_roots_ alike with w^-1
+        const Limb one = mont_.to(1);
+        const Limb generator = mont_.to(prime.root);
+        for (std::size_t len = 1; len < size; len *= 2)
+        {
+          const Limb w = mont_.power(generator, (prime.modulus - 1) / (2 * len));
+          const Limb w_inverse = mont_.power(w, 2 * len - 1);
+          Limb x = one;
+          Limb y = one;
+          for (std::size_t j = 0; j < len; ++j)
+          {
+            roots_[len + j] = x;
+            inverse_roots_[len + j] = y;
+            x = mont_.multiply(x, w);
+            y = mont_.multiply(y, w_inverse);
+          }
+        }
+
+        // Lifting multiplies by 2^128 mod p, which a Montgomery product turns
+        // into 2^64, and lowering by 1 / size, which removes that again
+        lift_ = mont_.to(one);
+        lower_ = prime.modulus - (prime.modulus - 1) / size;
+      }
+
+      // x[i] = limbs[i] in Montgomery form, padded with zeros to the transform size
+      void lift(std::span<const Limb> limbs, Limb *x) const noexcept
+      {
+        for (std::size_t i = 0; i < limbs.size(); ++i)
+        {
+          x[i] = mont_.multiply(limbs[i], lift_);
+        }
+        std::fill(x + limbs.size(), x + size_, Limb{0});
+      }
+
+      // Decimation in frequency: natural order in, bit-reversed order out
+      void forward(Limb *x) const noexcept
+      {
+        for (std::size_t len = size_ / 2; len >= 1; len /= 2)
+        {
+          for (std::size_t start = 0; start < size_; start += 2 * len)
+          {
+            for (std::size_t j = 0; j < len; ++j)
+            {
+              const Limb u = x[start + j];
+              const Limb v = x[start + len + j];
+              x[start + j] = mont_.add(u, v);
+              x[start + len + j] = mont_.multiply(mont_.subtract(u, v), roots_[len + j]);
+            }
+          }
+        }
+      }
+
+      // Decimation in time with inverse roots: bit-reversed order in, natural
+      // order out, still scaled by the size
+      void inverse(Limb *x) const noexcept
+      {
+        for (std::size_t len = 1; len < size_; len *= 2)
+        {
+          for (std::size_t start = 0; start < size_; start += 2 * len)
+          {
+            for (std::size_t j = 0; j < len; ++j)
+            {
+              const Limb u = x[start + j];
+              const Limb v = mont_.multiply(x[start + len + j], inverse_roots_[len + j]);
+              x[start + j] = mont_.add(u, v);
+              x[start + len + j] = mont_.subtract(u, v);
+            }
+          }
+        }
+      }
+
+      void pointwise(Limb *x, const Limb *y) const noexcept
+      {
+        for (std::size_t i = 0; i < size_; ++i)
+        {
+          x[i] = mont_.multiply(x[i], y[i]);
+        }
+      }
+
+      // Takes x[i] out of Montgomery form and divides by the size
+      Limb lower(Limb x) const noexcept
+      {
+        return mont_.multiply(x, lower_);
+      }
+
+    private:
+      modular::Montgomery mont_;
+      std::size_t size_;
+      std::vector<Limb> roots_;
+      std::vector<Limb> inverse_roots_;
+      Limb lift_ = 0;
+      Limb lower_ = 0;
+    };
+
+    // out[0, na + nb) = a * b by cyclic convolution modulo each NTT prime,
+    // recombined per term by Garner's algorithm and carried into place
+    void ntt_multiply(const Limb *a, std::size_t na, const Limb *b, std::size_t nb, Limb *out)
+    {
+      const std::size_t terms = na + nb - 1;
+      const std::size_t size = std::bit_ceil(terms);
+      const bool squaring = a == b && na == nb;
+
+      std::array<std::vector<Limb>, ntt_primes.size()> residues;
+      std::vector<Limb> x(size);
+      std::vector<Limb> y(squaring ? 0 : size);
+      for (std::size_t p = 0; p < ntt_primes.size(); ++p)
+      {
+        const Ntt ntt(ntt_primes[p], size);
+        ntt.lift({a, na}, x.data());
+        ntt.forward(x.data());
+        if (squaring)
+        {
+          ntt.pointwise(x.data(), x.data());
+        }
+        else
+        {
+          ntt.lift({b, nb}, y.data());
+          ntt.forward(y.data());
+          ntt.pointwise(x.data(), y.data());
+        }
+        ntt.inverse(x.data());
+
+        residues[p].resize(terms);
+        for (std::size_t i = 0; i < terms; ++i)
+        {
+          residues[p][i] = ntt.lower(x[i]);
+        }
+      }
+
+      // Garner: term = r0 + p0 (t1 + p1 t2) with t1 = (r1 - r0) / p0 mod p1 and
+      // t2 = (r2 - r0 - p0 t1) / (p0 p1) mod p2. The primes ascend, so r0 is
+      // already reduced modulo p1 and p2
+      const Limb p0 = ntt_primes[0].modulus;
+      const Limb p1 = ntt_primes[1].modulus;
+      const Limb p2 = ntt_primes[2].modulus;
+      const modular::Montgomery mont1(p1);
+      const modular::Montgomery mont2(p2);
+      const Limb inverse_p0 = mont1.to(modular::powmod(p0, p1 - 2, p1));
+      const Limb p0_mod_p2 = mont2.to(p0);
+      const Limb inverse_p0p1 = mont2.to(modular::powmod(modular::mulmod(p0, p1, p2), p2 - 2, p2));
+
+      // Running sum of the terms not yet written out; below 2^128 after each shift
+      Limb c0 = 0;
+      Limb c1 = 0;
+      for (std::size_t i = 0; i < terms; ++i)
+      {
+        const Limb r0 = residues[0][i];
+        const Limb t1 = mont1.multiply(mont1.subtract(residues[1][i], r0), inverse_p0);
+        const Limb t2 = mont2.multiply(
+            mont2.subtract(mont2.subtract(residues[2][i], r0), mont2.multiply(t1, p0_mod_p2)), inverse_p0p1);
+        const uint128_t u = uint128_t{t1} + uint128_t{p1} * t2;
+        const uint128_t low = uint128_t{p0} * static_cast<Limb>(u) + r0;
+        const uint128_t high = uint128_t{p0} * static_cast<Limb>(u >> 64) + static_cast<Limb>(low >> 64);
+
+        const uint128_t sum0 = uint128_t{c0} + static_cast<Limb>(low);
+        const uint128_t sum1 = uint128_t{c1} + static_cast<Limb>(high) + static_cast<Limb>(sum0 >> 64);
+        out[i] = static_cast<Limb>(sum0);
+        c0 = static_cast<Limb>(sum1);
+        c1 = static_cast<Limb>(high >> 64) + static_cast<Limb>(sum1 >> 64);
+      }
+      out[terms] = c0;
+    }
+
+    // out[0, na + nb) = a * b for na >= nb > 0. Below the NTT threshold, cuts
+    // a into nb-limb blocks so that every block product is square
+    void multiply(const Limb *a, std::size_t na, const Limb *b, std::size_t nb, Limb *out,
+                  Multiplication algorithm)
+    {
+      if (algorithm == Multiplication::ntt || (algorithm == Multiplication::automatic && nb >= ntt_threshold))
+      {
+        ntt_multiply(a, na, b, nb, out);
+        return;
+      }
+      if (algorithm == Multiplication::schoolbook || (algorithm == Multiplication::automatic && nb < karatsuba_threshold))
+      {
+        a == b && na == nb ? sqr_schoolbook(a, na, out) : mul_schoolbook(a, na, b, nb, out);
+        return;
+      }
+
+      std::vector<Limb> scratch(multiply_scratch(nb) + 2 * nb);
+      Limb *block = scratch.data() + multiply_scratch(nb);
+      std::fill_n(out, na + nb, Limb{0});
+      std::size_t i = 0;
+      for (; i + nb <= na; i += nb)
+      {
+        multiply_square(a + i, b, nb, block, scratch.data(), algorithm);
+        add_into(out + i, na + nb - i, block, 2 * nb);
+      }
+      if (i < na)
+      {
+        const std::size_t rest = na - i;
+        std::vector<Limb> tail(rest + nb);
+        multiply(b, nb, a + i, rest, tail.data(), algorithm);
+        add_into(out + i, na + nb - i, tail.data(), rest + nb);
+      }
+    }
+
+    // out[0, a.size() + b.size()) = a * b
+    void product(std::span<const Limb> a, std::span<const Limb> b, Limb *out, Multiplication algorithm)
+    {
+      if (a.empty() || b.empty())
+      {
+        std::fill_n(out, a.size() + b.size(), Limb{0});
+        return;
+      }
+      if (a.size() < b.size())
+      {
+        std::swap(a, b);
+      }
+
+      multiply(a.data(), a.size(), b.data(), b.size(), out, algorithm);
+    }
+
+    // q = u / d and returns u mod d, for a single-limb divisor d > 0
+    Limb divide_1(Limb *q, const Limb *u, std::size_t n, Limb d) noexcept
+    {
+      Limb rem = 0;
+      for (std::size_t i = n; i-- > 0;)
+      {
+        const uint128_t cur = (uint128_t{rem} << 64) | u[i];
+        q[i] = static_cast<Limb>(cur / d);
+        rem = static_cast<Limb>(cur % d);
+      }
+
+      return rem;
+    }
+
+    // Knuth's Algorithm D: q = u / v and r = u mod v, for v.size() >= 2 with a non-zero top limb
+    void divide(std::span<const Limb> u, std::span<const Limb> v, std::vector<Limb> &q, std::vector<Limb> &r)
+    {
+      const std::size_t n = v.size();
+      if (u.size() < n)
+      {
+        q.clear();
+        r.assign(u.begin(), u.end());
+        return;
+      }
+
+      // Normalize so that the top limb of the divisor has its high bit set,
+      // which keeps every quotient digit estimate within two of the truth
+      const int shift = std::countl_zero(v.back());
+      const std::size_t m = u.size() - n;
+      std::vector<Limb> vn(n);
+      std::vector<Limb> un(u.size() + 1);
+      for (std::size_t i = n; i-- > 0;)
+      {
+        vn[i] = (v[i] << shift) | (shift != 0 && i > 0 ? v[i - 1] >> (64 - shift) : 0);
+      }
+      un[u.size()] = shift != 0 ? u.back() >> (64 - shift) : 0;
+      for (std::size_t i = u.size(); i-- > 0;)
+      {
+        un[i] = (u[i] << shift) | (shift != 0 && i > 0 ? u[i - 1] >> (64 - shift) : 0);
+      }
+
+      q.assign(m + 1, 0);
+      std::vector<Limb> product_row(n + 1);
+      for (std::size_t j = m + 1; j-- > 0;)
+      {
+        const uint128_t top = (uint128_t{un[j + n]} << 64) | un[j + n - 1];
+        uint128_t qhat = top / vn[n - 1];
+        uint128_t rhat = top % vn[n - 1];
+        while (qhat >> 64 != 0 || qhat * vn[n - 2] > ((rhat << 64) | un[j + n - 2]))
+        {
+          --qhat;
+          rhat += vn[n - 1];
+          if (rhat >> 64 != 0)
+          {
+            break;
+          }
+        }
+
+        std::fill(product_row.begin(), product_row.end(), Limb{0});
+        product_row[n] = add_mul_1(product_row.data(), vn.data(), n, static_cast<Limb>(qhat));
+        if (sub_n(un.data() + j, un.data() + j, product_row.data(), n + 1) != 0)
+        {
+          // The estimate was one too large; add the divisor back
+          --qhat;
+          add_n(un.data() + j, un.data() + j, vn.data(), n);
+          un[j + n] = 0;
+        }
+        q[j] = static_cast<Limb>(qhat);
+      }
+
+      r.resize(n);
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        r[i] = (un[i] >> shift) | (shift != 0 ? un[i + 1] << (64 - shift) : 0);
+      }
+      while (!q.empty() && q.back() == 0)
+      {
+        q.pop_back();
+      }
+      while (!r.empty() && r.back() == 0)
+      {
+        r.pop_back();
+      }
+    }
+
+    void write_group(std::ostream &os, Limb group, bool pad)
+    {
+      std::array<char, decimal_digits> digits;
+      const auto end = std::to_chars(digits.data(), digits.data() + digits.size(), group).ptr;
+      const auto length = static_cast<std::size_t>(end - digits.data());
+      if (pad)
+      {
+        for (std::size_t i = length; i < digits.size(); ++i)
+        {
+          os.put('0');
+        }
+      }
+      os.write(digits.data(), static_cast<std::streamsize>(length));
+    }
+
+    // Quotient and remainder by schoolbook long division
+    std::pair<BigInt, BigInt> divide_schoolbook(const BigInt &u, const BigInt &v)
+    {
+      if (v.limbs().size() == 1)
+      {
+        std::vector<Limb> q(u.limbs().size());
+        const Limb r = divide_1(q.data(), u.limbs().data(), q.size(), v.limbs()[0]);
+        return {BigInt::from_limbs(q), BigInt(r)};
+      }
+
+      std::vector<Limb> q;
+      std::vector<Limb> r;
+      divide(u.limbs(), v.limbs(), q, r);
+
+      return {BigInt::from_limbs(q), BigInt::from_limbs(r)};
+    }
+
+    // Divisor width in bits up to which reciprocals come from schoolbook division
+    constexpr std::size_t reciprocal_threshold = 64 * 64;
+
+    // floor(2^(2k) / v) for v of bit width k. Newton's iteration
+    // x' = 2x - v x^2 / 2^(2k) doubles the precision of the reciprocal of the
+    // top half of v, and a final correction makes the floor exact
+    BigInt reciprocal(const BigInt &v)
+    {
+      const std::size_t k = v.bit_width();
+      const BigInt scale = BigInt(1) << (2 * k);
+      if (k <= reciprocal_threshold)
+      {
+        return divide_schoolbook(scale, v).first;
+      }
+
+      const std::size_t h = k / 2 + 64;
+      BigInt x = reciprocal(v >> (k - h)) << (k - h);
+      x = (x << 1) - ((v * square(x)) >> (2 * k));
+
+      BigInt vx = v * x;
+      while (vx > scale)
+      {
+        x -= 1U;
+        vx -= v;
+      }
+      for (vx += v; vx <= scale; vx += v)
+      {
+        x += 1U;
+      }
+
+      return x;
+    }
+
+    // A divisor 10^(19 * 2^level) of the decimal conversion, with its Barrett reciprocal
+    struct DecimalPower
+    {
+      BigInt value;
+      BigInt reciprocal;
+      std::size_t width;
+    };
+
+    // Levels whose operands are split into 19-digit groups by repeated
+    // single-limb division instead of further halving
+    constexpr std::size_t decimal_leaf_level = 4;
+
+    // Writes x < 10^(19 * 2^(level + 1)), padded to exactly that many digits when pad is set
+    void write_decimal_level(std::ostream &os, const BigInt &x, std::size_t level,
+                             const std::vector<DecimalPower> &powers, bool pad)
+    {
+      if (level <= decimal_leaf_level)
+      {
+        std::array<Limb, std::size_t{2} << decimal_leaf_level> groups{};
+        std::size_t count = 0;
+        std::vector<Limb> rest(x.limbs().begin(), x.limbs().end());
+        while (!rest.empty())
+        {
+          groups[count++] = divide_1(rest.data(), rest.data(), rest.size(), decimal_group);
+          while (!rest.empty() && rest.back() == 0)
+          {
+            rest.pop_back();
+          }
+        }
+
+        const std::size_t total = pad ? std::size_t{2} << level : std::max<std::size_t>(count, 1);
+        for (std::size_t i = total; i-- > 0;)
+        {
+          write_group(os, groups[i], pad || i + 1 < total);
+        }
+        return;
+      }
+
+      // Barrett division: the estimate falls short of the quotient by at most
+      // a few units, because x < value^2 <= 2^(2 width)
+      const DecimalPower &power = powers[level];
+      BigInt q = (x * power.reciprocal) >> (2 * power.width);
+      BigInt r = x - q * power.value;
+      while (r >= power.value)
+      {
+        r -= power.value;
+        q += 1U;
+      }
+
+      if (pad || !q.is_zero())
+      {
+        write_decimal_level(os, q, level - 1, powers, pad);
+        write_decimal_level(os, r, level - 1, powers, true);
+      }
+      else
+      {
+        write_decimal_level(os, r, level - 1, powers, false);
+      }
+    }
+
+  } // namespace
+
+  BigInt::Limbs::Limbs(const Limbs &other)
+  {
+    assign(other);
+  }
+
+  BigInt::Limbs::Limbs(Limbs &&other) noexcept
+      : heap_(std::move(other.heap_)), size_(other.size_), capacity_(other.capacity_)
+  {
+    std::copy_n(other.inline_, inline_capacity, inline_);
+    other.size_ = 0;
+    other.capacity_ = inline_capacity;
+  }
+
+  BigInt::Limbs &BigInt::Limbs::operator=(const Limbs &other)
+  {
+    if (this != &other)
+    {
+      assign(other);
+    }
+
+    return *this;
+  }
+
+  BigInt::Limbs &BigInt::Limbs::operator=(Limbs &&other) noexcept
+  {
+    if (this != &other)
+    {
+      heap_ = std::move(other.heap_);
+      size_ = other.size_;
+      capacity_ = other.capacity_;
+      std::copy_n(other.inline_, inline_capacity, inline_);
+      other.size_ = 0;
+      other.capacity_ = inline_capacity;
+    }
+
+    return *this;
+  }
+
+  void BigInt::Limbs::reserve(std::size_t capacity)
+  {
+    if (capacity <= capacity_)
+    {
+      return;
+    }
+
+    auto heap = std::make_unique_for_overwrite<std::uint64_t[]>(capacity);
+    std::copy_n(data(), size_, heap.get());
+    heap_ = std::move(heap);
+    capacity_ = capacity;
+  }
+
+  void BigInt::Limbs::resize(std::size_t size)
+  {
+    if (size > capacity_)
+    {
+      reserve(std::max(size, 2 * capacity_));
+    }
+    if (size > size_)
+    {
+      std::fill(data() + size_, data() + size, std::uint64_t{0});
+    }
+    size_ = size;
+  }
+
+  void BigInt::Limbs::push_back(std::uint64_t limb)
+  {
+    if (size_ == capacity_)
+    {
+      reserve(2 * capacity_);
+    }
+    data()[size_++] = limb;
+  }
+
+  void BigInt::Limbs::assign(std::span<const std::uint64_t> limbs)
+  {
+    size_ = 0;
+    reserve(limbs.size());
+    std::copy(limbs.begin(), limbs.end(), data());
+    size_ = limbs.size();
+  }
+
+  BigInt BigInt::from_limbs(std::span<const std::uint64_t> limbs)
+  {
+    BigInt result;
+    result.limbs_.assign(limbs);
+    result.trim();
+
+    return result;
+  }
+
+  void BigInt::trim() noexcept
+  {
+    while (!limbs_.empty() && limbs_.back() == 0)
+    {
+      limbs_.pop_back();
+    }
+  }
+
+  std::size_t BigInt::bit_width() const noexcept
+  {
+    if (limbs_.empty())
+    {
+      return 0;
+    }
+
+    return 64 * (limbs_.size() - 1) + static_cast<std::size_t>(std::bit_width(limbs_.back()));
+  }
+
+  BigInt &BigInt::operator+=(const BigInt &other)
+  {
+    if (limbs_.size() < other.limbs_.size())
+    {
+      limbs_.resize(other.limbs_.size());
+    }
+    if (add_into(limbs_.data(), limbs_.size(), other.limbs_.data(), other.limbs_.size()) != 0)
+    {
+      limbs_.push_back(1);
+    }
+
+    return *this;
+  }
+
+  BigInt &BigInt::operator-=(const BigInt &other)
+  {
+    if (*this < other)
+    {
+      throw std::invalid_argument("Difference would be negative");
+    }
+
+    sub_from(limbs_.data(), limbs_.size(), other.limbs_.data(), other.limbs_.size());
+    trim();
+
+    return *this;
+  }
+
+  BigInt &BigInt::operator*=(const BigInt &other)
+  {
+    return *this = *this * other;
+  }
+
+  BigInt &BigInt::operator<<=(std::size_t bits)
+  {
+    if (limbs_.empty())
+    {
+      return *this;
+    }
+
+    const std::size_t words = bits / 64;
+    const unsigned shift = static_cast<unsigned>(bits % 64);
+    const std::size_t size = limbs_.size();
+    limbs_.resize(size + words + 1);
+
+    // Move limbs up from the top so that no source limb is overwritten before it is read
+    for (std::size_t i = size + words + 1; i-- > words;)
+    {
+      const std::size_t src = i - words;
+      const Limb lo = src < size ? limbs_[src] << shift : 0;
+      const Limb hi = shift != 0 && src > 0 ? limbs_[src - 1] >> (64 - shift) : 0;
+      limbs_[i] = lo | hi;
+    }
+    std::fill_n(limbs_.data(), words, Limb{0});
+    trim();
+
+    return *this;
+  }
+
+  BigInt &BigInt::operator>>=(std::size_t bits)
+  {
+    const std::size_t words = bits / 64;
+    if (words >= limbs_.size())
+    {
+      limbs_.clear();
+      return *this;
+    }
+
+    const unsigned shift = static_cast<unsigned>(bits % 64);
+    const std::size_t size = limbs_.size() - words;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      const Limb lo = limbs_[i + words] >> shift;
+      const Limb hi = shift != 0 && i + words + 1 < limbs_.size() ? limbs_[i + words + 1] << (64 - shift) : 0;
+      limbs_[i] = lo | hi;
+    }
+    limbs_.resize(size);
+    trim();
+
+    return *this;
+  }
+
+  BigInt operator*(const BigInt &a, const BigInt &b)
+  {
+    return multiply(a, b, BigInt::Multiplication::automatic);
+  }
+
+  BigInt square(const BigInt &a)
+  {
+    return multiply(a, a, BigInt::Multiplication::automatic);
+  }
+
+  BigInt multiply(const BigInt &a, const BigInt &b, BigInt::Multiplication algorithm)
+  {
+    BigInt result;
+    result.limbs_.resize(a.limbs_.size() + b.limbs_.size());
+    product(a.limbs_, b.limbs_, result.limbs_.data(), algorithm);
+    result.trim();
+
+    return result;
+  }
+
+  std::strong_ordering operator<=>(const BigInt &a, const BigInt &b) noexcept
+  {
+    if (a.limbs_.size() != b.limbs_.size())
+    {
+      return a.limbs_.size() <=> b.limbs_.size();
+    }
+
+    for (std::size_t i = a.limbs_.size(); i-- > 0;)
+    {
+      if (a.limbs_[i] != b.limbs_[i])
+      {
+        return a.limbs_[i] <=> b.limbs_[i];
+      }
+    }
+
+    return std::strong_ordering::equal;
+  }
+
+  void BigInt::write_decimal(std::ostream &os) const
+  {
+    // Find the smallest level whose range 10^(19 * 2^(level + 1)) exceeds the
+    // value, building the divisors 10^(19 * 2^k) by repeated squaring. Only
+    // the levels above the leaves divide, so only they need a reciprocal
+    std::vector<DecimalPower> powers = {{BigInt(decimal_group), {}, 0}};
+    for (BigInt next = square(powers.back().value); next <= *this; next = square(powers.back().value))
+    {
+      const std::size_t width = next.bit_width();
+      BigInt inverse = powers.size() > decimal_leaf_level ? reciprocal(next) : BigInt{};
+      powers.push_back({std::move(next), std::move(inverse), width});
+    }
+
+    write_decimal_level(os, *this, powers.size() - 1, powers, false);
+  }
+
+  void BigInt::write_hex(std::ostream &os) const
+  {
+    if (limbs_.empty())
+    {
+      os.put('0');
+      return;
+    }
+
+    std::array<char, 16> digits;
+    for (std::size_t i = limbs_.size(); i-- > 0;)
+    {
+      const auto end = std::to_chars(digits.data(), digits.data() + digits.size(), limbs_[i], 16).ptr;
+      const auto length = static_cast<std::size_t>(end - digits.data());
+      if (i + 1 < limbs_.size())
+      {
+        for (std::size_t j = length; j < digits.size(); ++j)
+        {
+          os.put('0');
+        }
+      }
+      os.write(digits.data(), static_cast<std::streamsize>(length));
+    }
+  }
+
+  std::string BigInt::to_string() const
+  {
+    std::ostringstream os;
+    write_decimal(os);
+
+    return os.str();
+  }
+
+  std::ostream &operator<<(std::ostream &os, const BigInt &value)
+  {
+    if ((os.flags() & std::ios_base::basefield) == std::ios_base::hex)
+    {
+      value.write_hex(os);
+    }
+    else
+    {
+      value.write_decimal(os);
+    }
+
+    return os;
+  }
+
+} // namespace cpp_concept
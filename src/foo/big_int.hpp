@@ -0,0 +1,368 @@
+#pragma once
+
+#include <algorithm>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+/**
+ * @file foo/big_int.hpp
+ * @brief Header file for the BigInt class of arbitrary-precision integers.
+ *
+ * This file defines the BigInt class within the cpp_concept namespace. A
+ * BigInt holds a non-negative integer of any size as 64-bit limbs, so exact
+ * results such as large Fibonacci numbers are not capped by the width of a
+ * built-in type.
+ *
+ * @author Sentenz
+ * @copyright Copyright (c) 2026 Sentenz
+ * @license SPDX-License-Identifier: Apache-2.0
+ */
+
+namespace cpp_concept
+{
+
+  /**
+   * @brief Arbitrary-precision non-negative integer.
+   *
+   * Stores the value as little-endian 64-bit limbs without leading zero
+   * limbs, so zero has no limbs at all. Values below \f$2^{128}\f$ keep their
+   * limbs inline and never allocate. Products switch from schoolbook to
+   * Karatsuba, then Toom-3, then a number-theoretic transform as the shorter
+   * operand grows, and squaring has a dedicated path at every size.
+   *
+   * @note Thread safety: Distinct objects may be used concurrently; a shared
+   *       object is safe for concurrent reads only.
+   *
+   * @see Foo::fibonacci_big()
+   * @see Foo::multiply(const BigInt &, const BigInt &)
+   *
+   * @code
+   * BigInt x(1);
+   * x <<= 64;                // 18446744073709551616
+   * x = x * x;               // 2^128
+   * std::cout << x << '\n';  // 340282366920938463463374607431768211456
+   * @endcode
+   *
+   * @since 1.1
+   */
+  class BigInt
+  {
+  public:
+    /**
+     * @brief Multiplication algorithms, selectable to compare one against another.
+     */
+    enum class Multiplication
+    {
+      automatic,  ///< Picks the fastest by the length of the shorter operand
+      schoolbook, ///< Quadratic long multiplication
+      karatsuba,  ///< Three half-size products, \f$O(n^{1.585})\f$
+      toom3,      ///< Toom-Cook 3-way, five third-size products, \f$O(n^{1.465})\f$
+      ntt,        ///< Number-theoretic transforms over three primes, \f$O(n \log n)\f$
+    };
+
+    /**
+     * @brief Constructs zero.
+     */
+    BigInt() = default;
+
+    /**
+     * @brief Constructs the value of an unsigned built-in integer.
+     *
+     * Implicit, so unsigned operands mix with BigInt in expressions.
+     *
+     * @param[in] value The initial value.
+     */
+    template <std::unsigned_integral T>
+    BigInt(T value)
+    {
+      if (value != 0)
+      {
+        limbs_.push_back(static_cast<std::uint64_t>(value));
+      }
+    }
+
+    /**
+     * @brief Constructs the value of a signed built-in integer.
+     *
+     * Explicit, so a negative int cannot silently wrap into a huge BigInt
+     * where a BigInt operand is expected; such calls fail to compile instead.
+     *
+     * @param[in] value The initial value.
+     *
+     * @throws std::invalid_argument If value is negative.
+     */
+    template <std::signed_integral T>
+    explicit BigInt(T value)
+        : BigInt(static_cast<std::make_unsigned_t<T>>(value))
+    {
+      if (value < 0)
+      {
+        throw std::invalid_argument("Negative input not allowed");
+      }
+    }
+
+    /**
+     * @brief Constructs a value from its limbs.
+     *
+     * @param[in] limbs The limbs, least significant first; leading zero limbs are dropped.
+     *
+     * @return The value \f$\sum_i limbs_i \cdot 2^{64 i}\f$.
+     */
+    static BigInt from_limbs(std::span<const std::uint64_t> limbs);
+
+    /**
+     * @brief Returns the limbs, least significant first.
+     *
+     * @return The limbs of the value; empty for zero, otherwise the last limb is non-zero.
+     */
+    std::span<const std::uint64_t> limbs() const noexcept
+    {
+      return limbs_;
+    }
+
+    /**
+     * @brief Checks whether the value is zero.
+     */
+    bool is_zero() const noexcept
+    {
+      return limbs_.empty();
+    }
+
+    /**
+     * @brief Returns the number of significant bits.
+     *
+     * @return The smallest b with value < 2^b; 0 for zero.
+     */
+    std::size_t bit_width() const noexcept;
+
+    /**
+     * @brief Adds other in place.
+     *
+     * One carry chain over the longer operand, so it costs \f$O(n)\f$ in
+     * the limb count n of the longer one.
+     *
+     * @param[in] other The addend.
+     *
+     * @return This value, now the sum.
+     */
+    BigInt &operator+=(const BigInt &other);
+
+    /**
+     * @brief Subtracts other in place.
+     *
+     * @throws std::invalid_argument If other is greater than the value.
+     */
+    BigInt &operator-=(const BigInt &other);
+
+    /**
+     * @brief Multiplies by other in place.
+     *
+     * Takes the automatic algorithm by the length n of the shorter operand:
+     * schoolbook below 32 limbs, Karatsuba below 128, Toom-3 below 2048 and
+     * number-theoretic transforms from there, so the cost grows from
+     * \f$O(n^2)\f$ to \f$O(n \log n)\f$. Multiplying a value by itself takes
+     * the squaring path.
+     *
+     * @param[in] other The factor.
+     *
+     * @return This value, now the product.
+     *
+     * @see multiply()
+     */
+    BigInt &operator*=(const BigInt &other);
+
+    /**
+     * @brief Shifts left in place, multiplying by \f$2^{bits}\f$.
+     *
+     * @param[in] bits The number of bit positions to shift by.
+     *
+     * @return This value, now \f$value \cdot 2^{bits}\f$.
+     */
+    BigInt &operator<<=(std::size_t bits);
+
+    /**
+     * @brief Shifts right in place, dividing by \f$2^{bits}\f$ and rounding down.
+     *
+     * @param[in] bits The number of bit positions to shift by.
+     *
+     * @return This value, now \f$\lfloor value / 2^{bits} \rfloor\f$; zero once bits reaches bit_width().
+     */
+    BigInt &operator>>=(std::size_t bits);
+
+    friend BigInt operator+(BigInt a, const BigInt &b)
+    {
+      return a += b;
+    }
+
+    /**
+     * @throws std::invalid_argument If b is greater than a.
+     */
+    friend BigInt operator-(BigInt a, const BigInt &b)
+    {
+      return a -= b;
+    }
+
+    friend BigInt operator*(const BigInt &a, const BigInt &b);
+
+    friend BigInt operator<<(BigInt a, std::size_t bits)
+    {
+      return a <<= bits;
+    }
+
+    friend BigInt operator>>(BigInt a, std::size_t bits)
+    {
+      return a >>= bits;
+    }
+
+    /**
+     * @brief Computes \f$a^2\f$, faster than a * a.
+     */
+    friend BigInt square(const BigInt &a);
+
+    /**
+     * @brief Computes \f$a \cdot b\f$ with a chosen algorithm.
+     *
+     * The algorithm applies at the top level only; the smaller products it
+     * splits into pick their own by size, as with automatic. Karatsuba and
+     * Toom-3 fall back to schoolbook below 2 and 5 limbs, where they cannot
+     * split.
+     *
+     * @param[in] a The first factor.
+     * @param[in] b The second factor.
+     * @param[in] algorithm The algorithm for the top-level product.
+     *
+     * @return The product, the same whichever algorithm computes it.
+     */
+    friend BigInt multiply(const BigInt &a, const BigInt &b, Multiplication algorithm);
+
+    friend bool operator==(const BigInt &a, const BigInt &b) noexcept = default;
+    friend std::strong_ordering operator<=>(const BigInt &a, const BigInt &b) noexcept;
+
+    /**
+     * @brief Writes the value in decimal without building it as a string first.
+     *
+     * Splits the value by divide and conquer on \f$10^{19 \cdot 2^k}\f$, so
+     * the digits are produced most significant first and streamed in
+     * 19-digit groups. Each split is a Barrett division by a reciprocal
+     * found with Newton's iteration, so the conversion costs a logarithmic
+     * number of multiplications of the size of the value.
+     *
+     * @param[in,out] os The stream to write to.
+     */
+    void write_decimal(std::ostream &os) const;
+
+    /**
+     * @brief Writes the value in lowercase hexadecimal, without a prefix.
+     *
+     * @param[in,out] os The stream to write to.
+     */
+    void write_hex(std::ostream &os) const;
+
+    /**
+     * @brief Returns the decimal representation.
+     */
+    std::string to_string() const;
+
+    /**
+     * @brief Writes the value in hexadecimal if std::hex is set on os, in decimal otherwise.
+     */
+    friend std::ostream &operator<<(std::ostream &os, const BigInt &value);
+
+  private:
+    // Limb storage holding up to two limbs inline, like a vector with a small buffer
+    class Limbs
+    {
+    public:
+      Limbs() noexcept = default;
+      Limbs(const Limbs &other);
+      Limbs(Limbs &&other) noexcept;
+      Limbs &operator=(const Limbs &other);
+      Limbs &operator=(Limbs &&other) noexcept;
+      ~Limbs() = default;
+
+      std::uint64_t *data() noexcept
+      {
+        return heap_ ? heap_.get() : inline_;
+      }
+
+      const std::uint64_t *data() const noexcept
+      {
+        return heap_ ? heap_.get() : inline_;
+      }
+
+      std::size_t size() const noexcept
+      {
+        return size_;
+      }
+
+      bool empty() const noexcept
+      {
+        return size_ == 0;
+      }
+
+      std::uint64_t &operator[](std::size_t i) noexcept
+      {
+        return data()[i];
+      }
+
+      std::uint64_t operator[](std::size_t i) const noexcept
+      {
+        return data()[i];
+      }
+
+      std::uint64_t back() const noexcept
+      {
+        return data()[size_ - 1];
+      }
+
+      // Grows with zero limbs or shrinks to size
+      void resize(std::size_t size);
+      void push_back(std::uint64_t limb);
+
+      void pop_back() noexcept
+      {
+        --size_;
+      }
+
+      void clear() noexcept
+      {
+        size_ = 0;
+      }
+
+      void assign(std::span<const std::uint64_t> limbs);
+
+      operator std::span<const std::uint64_t>() const noexcept
+      {
+        return {data(), size_};
+      }
+
+      friend bool operator==(const Limbs &a, const Limbs &b) noexcept
+      {
+        return std::ranges::equal(std::span<const std::uint64_t>(a), std::span<const std::uint64_t>(b));
+      }
+
+    private:
+      static constexpr std::size_t inline_capacity = 2;
+
+      void reserve(std::size_t capacity);
+
+      std::uint64_t inline_[inline_capacity] = {};
+      std::unique_ptr<std::uint64_t[]> heap_;
+      std::size_t size_ = 0;
+      std::size_t capacity_ = inline_capacity;
+    };
+
+    void trim() noexcept;
+
+    Limbs limbs_;
+  };
+
+} // namespace cpp_concept
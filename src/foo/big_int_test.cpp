@@ -0,0 +1,392 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "foo/big_int.hpp"
+
+using namespace cpp_concept;
+
+namespace
+{
+
+  BigInt power_of_ten(int exponent)
+  {
+    BigInt result = 1U;
+    for (int i = 0; i < exponent; ++i)
+    {
+      result *= 10U;
+    }
+
+    return result;
+  }
+
+  BigInt random_big_int(std::mt19937_64 &engine, std::size_t limbs)
+  {
+    std::vector<std::uint64_t> values(limbs);
+    for (auto &value : values)
+    {
+      value = engine();
+    }
+    values.back() |= 1; // Keep the requested length
+
+    return BigInt::from_limbs(values);
+  }
+
+} // namespace
+
+TEST(BigIntTest, Construct)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      long long value;
+    } in;
+
+    struct Want
+    {
+      std::string result;
+      bool throws_exception;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"zero", /* in */ {0}, /* want */ {"0", false}},
+      {"positive", /* in */ {5}, /* want */ {"5", false}},
+      {"boundary: long long max", /* in */ {9223372036854775807LL}, /* want */ {"9223372036854775807", false}},
+      {"minus one", /* in */ {-1}, /* want */ {"", true}},
+      {"boundary: long long min", /* in */ {-9223372036854775807LL - 1}, /* want */ {"", true}},
+  };
+
+  // Only unsigned values convert implicitly, so a negative int cannot wrap into a BigInt operand
+  static_assert(std::is_convertible_v<unsigned, BigInt>);
+  static_assert(std::is_convertible_v<std::uint64_t, BigInt>);
+  static_assert(!std::is_convertible_v<int, BigInt>);
+  static_assert(!std::is_convertible_v<long, BigInt>);
+  static_assert(std::is_constructible_v<BigInt, int>);
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(BigInt{tc.in.value}, std::invalid_argument);
+    }
+    else
+    {
+      EXPECT_EQ(BigInt(tc.in.value).to_string(), tc.want.result);
+    }
+  }
+}
+
+TEST(BigIntTest, Arithmetic)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      BigInt a;
+      BigInt b;
+      char op;
+    } in;
+
+    struct Want
+    {
+      std::string result;
+      bool throws_exception;
+    } want;
+  };
+
+  const BigInt two_64 = BigInt(1) << 64;
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"zero plus zero", /* in */ {0U, 0U, '+'}, /* want */ {"0", false}},
+      {"carry into a new limb", /* in */ {~std::uint64_t{0}, 1U, '+'}, /* want */ {"18446744073709551616", false}},
+      {"borrow across a limb", /* in */ {two_64, 1U, '-'}, /* want */ {"18446744073709551615", false}},
+      {"difference is zero", /* in */ {two_64, two_64, '-'}, /* want */ {"0", false}},
+      {"negative difference", /* in */ {1U, 2U, '-'}, /* want */ {"", true}},
+      {"multiply by zero", /* in */ {two_64, 0U, '*'}, /* want */ {"0", false}},
+      {"two-limb product", /* in */ {two_64 + 1U, two_64 - 1U, '*'}, /* want */ {"340282366920938463463374607431768211455", false}},
+      {"square of 2^64", /* in */ {two_64, two_64, '*'}, /* want */ {"340282366920938463463374607431768211456", false}},
+      {"shift left across limbs", /* in */ {3U, 127U, '<'}, /* want */ {"510423550381407695195061911147652317184", false}},
+      {"shift right to one limb", /* in */ {two_64 * two_64, 100U, '>'}, /* want */ {"268435456", false}},
+      {"shift right past the value", /* in */ {two_64, 65U, '>'}, /* want */ {"0", false}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    const std::size_t bits = tc.in.b.limbs().empty() ? 0 : static_cast<std::size_t>(tc.in.b.limbs()[0]);
+
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(tc.in.a - tc.in.b, std::invalid_argument);
+      continue;
+    }
+
+    BigInt got;
+    switch (tc.in.op)
+    {
+    case '+':
+      got = tc.in.a + tc.in.b;
+      break;
+    case '-':
+      got = tc.in.a - tc.in.b;
+      break;
+    case '*':
+      got = tc.in.a * tc.in.b;
+      break;
+    case '<':
+      got = tc.in.a << bits;
+      break;
+    default:
+      got = tc.in.a >> bits;
+      break;
+    }
+    EXPECT_EQ(got.to_string(), tc.want.result);
+  }
+}
+
+TEST(BigIntTest, MultiplyMatchesSchoolbook)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::size_t a_limbs;
+      std::size_t b_limbs;
+    } in;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"below the Karatsuba threshold", /* in */ {31, 31}},
+      {"at the Karatsuba threshold", /* in */ {32, 32}},
+      {"odd length split", /* in */ {77, 77}},
+      {"several recursion levels", /* in */ {700, 700}},
+      {"unbalanced operands", /* in */ {1000, 96}},
+      {"unbalanced with a short tail", /* in */ {250, 64}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    std::mt19937_64 engine(11);
+    const BigInt a = random_big_int(engine, tc.in.a_limbs);
+    const BigInt b = random_big_int(engine, tc.in.b_limbs);
+    const BigInt copy = BigInt::from_limbs(a.limbs()); // Distinct storage, so a * copy is not squared
+
+    // Sum of a times each limb of b, shifted into place, only ever multiplies by one limb
+    BigInt want;
+    for (std::size_t j = 0; j < b.limbs().size(); ++j)
+    {
+      want += (a * BigInt(b.limbs()[j])) << (64 * j);
+    }
+
+    // Act
+    auto got = a * b;
+    auto got_square = square(a);
+
+    // Assert
+    EXPECT_EQ(got, want);
+    EXPECT_EQ(got_square, a * copy);
+  }
+}
+
+TEST(BigIntTest, MultiplyAlgorithmsAgree)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::size_t a_limbs;
+      std::size_t b_limbs;
+      bool all_ones; // Every limb 2^64 - 1, the largest carries and transform terms
+      bool squaring;
+    } in;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"single limbs", /* in */ {1, 1, true, false}},
+      {"smallest Toom-3 split", /* in */ {5, 5, true, false}},
+      {"Toom-3 with a short top third", /* in */ {7, 7, false, false}},
+      {"Toom-3 with equal thirds", /* in */ {9, 9, true, true}},
+      {"Toom-3 into Karatsuba", /* in */ {301, 301, false, false}},
+      {"Toom-3 into Toom-3", /* in */ {1000, 1000, true, false}},
+      {"squaring", /* in */ {1000, 1000, false, true}},
+      {"unbalanced operands", /* in */ {2500, 400, false, false}},
+      {"past the NTT threshold", /* in */ {3000, 3000, true, false}},
+      {"NTT squaring", /* in */ {3000, 3000, true, true}},
+  };
+
+  const std::vector<BigInt::Multiplication> algorithms = {
+      BigInt::Multiplication::automatic,
+      BigInt::Multiplication::karatsuba,
+      BigInt::Multiplication::toom3,
+      BigInt::Multiplication::ntt,
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    std::mt19937_64 engine(5);
+    const auto make = [&](std::size_t limbs)
+    {
+      return tc.in.all_ones ? BigInt::from_limbs(std::vector<std::uint64_t>(limbs, ~std::uint64_t{0}))
+                            : random_big_int(engine, limbs);
+    };
+    const BigInt a = make(tc.in.a_limbs);
+    const BigInt b = tc.in.squaring ? a : make(tc.in.b_limbs);
+    const BigInt &factor = tc.in.squaring ? a : b;
+    const BigInt want = multiply(a, factor, BigInt::Multiplication::schoolbook);
+
+    for (const auto algorithm : algorithms)
+    {
+      SCOPED_TRACE(static_cast<int>(algorithm));
+
+      // Act
+      auto got = multiply(a, factor, algorithm);
+      auto got_swapped = multiply(factor, a, algorithm);
+
+      // Assert
+      EXPECT_EQ(got, want);
+      EXPECT_EQ(got_swapped, want);
+    }
+  }
+}
+
+TEST(BigIntTest, SmallBuffer)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      BigInt value;
+    } in;
+
+    struct Want
+    {
+      std::size_t limbs;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"zero", /* in */ {0U}, /* want */ {0}},
+      {"one inline limb", /* in */ {~std::uint64_t{0}}, /* want */ {1}},
+      {"largest inline value", /* in */ {(BigInt(1) << 128) - 1U}, /* want */ {2}},
+      {"first heap value", /* in */ {BigInt(1) << 128}, /* want */ {3}},
+      {"many limbs", /* in */ {BigInt(3) << 1000}, /* want */ {16}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Act
+    BigInt copy = tc.in.value;
+    BigInt moved = std::move(copy);
+    BigInt assigned = BigInt(1) << 200;
+    assigned = moved;
+    BigInt move_assigned = 7U;
+    move_assigned = std::move(moved);
+    BigInt grown = tc.in.value;
+    grown += BigInt(1) << 192;
+
+    // Assert
+    EXPECT_EQ(tc.in.value.limbs().size(), tc.want.limbs);
+    EXPECT_EQ(assigned, tc.in.value);
+    EXPECT_EQ(move_assigned, tc.in.value);
+    EXPECT_EQ(grown - (BigInt(1) << 192), tc.in.value);
+    EXPECT_TRUE(copy.is_zero()); // NOLINT(bugprone-use-after-move): a moved-from BigInt is zero
+  }
+}
+
+TEST(BigIntTest, Output)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      BigInt value;
+    } in;
+
+    struct Want
+    {
+      std::string decimal;
+      std::string hex;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"zero", /* in */ {0U}, /* want */ {"0", "0"}},
+      {"one limb", /* in */ {255U}, /* want */ {"255", "ff"}},
+      {"largest group", /* in */ {power_of_ten(19) - 1U}, /* want */ {std::string(19, '9'), "8ac7230489e7ffff"}},
+      {"smallest two-group value", /* in */ {power_of_ten(19)}, /* want */ {"1" + std::string(19, '0'), "8ac7230489e80000"}},
+      {"zero limb in the middle", /* in */ {BigInt(1) << 128}, /* want */ {"340282366920938463463374607431768211456", "100000000000000000000000000000000"}},
+      {"interior zero groups", /* in */ {power_of_ten(100) + 1U}, /* want */ {"1" + std::string(99, '0') + "1", ""}},
+      {"first divide and conquer level", /* in */ {power_of_ten(608)}, /* want */ {"1" + std::string(608, '0'), ""}},
+      {"just below a level boundary", /* in */ {power_of_ten(1216) - 1U}, /* want */ {std::string(1216, '9'), ""}},
+      {"several levels", /* in */ {power_of_ten(5000) + 7U}, /* want */ {"1" + std::string(4999, '0') + "7", ""}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    std::ostringstream decimal;
+    std::ostringstream hex;
+
+    // Act
+    decimal << tc.in.value;
+    hex << std::hex << tc.in.value;
+
+    // Assert
+    EXPECT_EQ(decimal.str(), tc.want.decimal);
+    EXPECT_EQ(tc.in.value.to_string(), tc.want.decimal);
+    if (!tc.want.hex.empty())
+    {
+      EXPECT_EQ(hex.str(), tc.want.hex);
+    }
+  }
+}
@@ -0,0 +1,287 @@
+#include "foo/divider.hpp"
+#include "foo/simd.hpp"
+
+#include <bit>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+namespace cpp_concept
+{
+
+  namespace
+  {
+
+    // Magic constants unpacked into the form every kernel consumes
+    struct Params
+    {
+      std::int32_t magic;
+      unsigned shift;
+      bool add;
+      std::int32_t sign;
+    };
+
+    template <typename T>
+    void divide_scalar(const Divider &divider, const int *in, T *out, std::size_t first, std::size_t n)
+    {
+      for (std::size_t i = first; i < n; ++i)
+      {
+        out[i] = static_cast<T>(divider.quotient(in[i]));
+      }
+    }
+
+#if CPP_CONCEPT_SIMD_X86
+    CPP_CONCEPT_TARGET("sse2")
+    __m128i quotient_sse2(__m128i n, const Params &p)
+    {
+      const __m128i sign = _mm_set1_epi32(p.sign);
+      const __m128i shift = _mm_cvtsi32_si128(static_cast<int>(p.shift));
+
+      if (p.magic == 0)
+      {
+        const __m128i bias = _mm_and_si128(_mm_srai_epi32(n, 31), _mm_set1_epi32(static_cast<int>((1U << p.shift) - 1)));
+        const __m128i q = _mm_sra_epi32(_mm_add_epi32(n, bias), shift);
+        return _mm_sub_epi32(_mm_xor_si128(q, sign), sign);
+      }
+
+      // SSE2 only has an unsigned 32x32->64 multiply; the signed high half is the
+      // unsigned one minus each operand masked by the other's sign
+      const __m128i magic = _mm_set1_epi32(p.magic);
+      const __m128i even = _mm_mul_epu32(n, magic);
+      const __m128i odd = _mm_mul_epu32(_mm_srli_epi64(n, 32), magic);
+      __m128i hi = _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 3, 1)),
+                                      _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 3, 1)));
+      hi = _mm_sub_epi32(hi, _mm_and_si128(_mm_srai_epi32(n, 31), magic));
+      hi = _mm_sub_epi32(hi, _mm_and_si128(_mm_srai_epi32(magic, 31), n));
+
+      if (p.add)
+      {
+        hi = _mm_add_epi32(hi, _mm_sub_epi32(_mm_xor_si128(n, sign), sign));
+      }
+
+      const __m128i q = _mm_sra_epi32(hi, shift);
+      return _mm_sub_epi32(q, _mm_srai_epi32(q, 31));
+    }
+
+    template <typename T>
+    CPP_CONCEPT_TARGET("sse2")
+    void divide_sse2(const Divider &divider, const Params &p, const int *in, T *out, std::size_t n)
+    {
+      std::size_t i = 0;
+      for (; i + 4 <= n; i += 4)
+      {
+        const __m128i q = quotient_sse2(_mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i)), p);
+
+        if constexpr (std::is_same_v<T, double>)
+        {
+          _mm_storeu_pd(out + i, _mm_cvtepi32_pd(q));
+          _mm_storeu_pd(out + i + 2, _mm_cvtepi32_pd(_mm_shuffle_epi32(q, _MM_SHUFFLE(1, 0, 3, 2))));
+        }
+        else
+        {
+          _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), q);
+        }
+      }
+
+      divide_scalar(divider, in, out, i, n);
+    }
+
+    CPP_CONCEPT_TARGET("avx2")
+    __m256i quotient_avx2(__m256i n, const Params &p)
+    {
+      const __m256i sign = _mm256_set1_epi32(p.sign);
+      const __m128i shift = _mm_cvtsi32_si128(static_cast<int>(p.shift));
+
+      if (p.magic == 0)
+      {
+        const __m256i bias =
+            _mm256_and_si256(_mm256_srai_epi32(n, 31), _mm256_set1_epi32(static_cast<int>((1U << p.shift) - 1)));
+        const __m256i q = _mm256_sra_epi32(_mm256_add_epi32(n, bias), shift);
+        return _mm256_sub_epi32(_mm256_xor_si256(q, sign), sign);
+      }
+
+      const __m256i magic = _mm256_set1_epi32(p.magic);
+      const __m256i even = _mm256_mul_epi32(n, magic);
+      const __m256i odd = _mm256_mul_epi32(_mm256_srli_epi64(n, 32), magic);
+      __m256i hi = _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0xAA);
+
+      if (p.add)
+      {
+        hi = _mm256_add_epi32(hi, _mm256_sub_epi32(_mm256_xor_si256(n, sign), sign));
+      }
+
+      const __m256i q = _mm256_sra_epi32(hi, shift);
+      return _mm256_sub_epi32(q, _mm256_srai_epi32(q, 31));
+    }
+
+    template <typename T>
+    CPP_CONCEPT_TARGET("avx2")
+    void divide_avx2(const Divider &divider, const Params &p, const int *in, T *out, std::size_t n)
+    {
+      std::size_t i = 0;
+      for (; i + 8 <= n; i += 8)
+      {
+        const __m256i q = quotient_avx2(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i)), p);
+
+        if constexpr (std::is_same_v<T, double>)
+        {
+          _mm256_storeu_pd(out + i, _mm256_cvtepi32_pd(_mm256_castsi256_si128(q)));
+          _mm256_storeu_pd(out + i + 4, _mm256_cvtepi32_pd(_mm256_extracti128_si256(q, 1)));
+        }
+        else
+        {
+          _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i), q);
+        }
+      }
+
+      divide_scalar(divider, in, out, i, n);
+    }
+
+    CPP_CONCEPT_AVX512_BEGIN
+    CPP_CONCEPT_TARGET("avx512f")
+    __m512i quotient_avx512(__m512i n, const Params &p)
+    {
+      const __m512i sign = _mm512_set1_epi32(p.sign);
+      const __m128i shift = _mm_cvtsi32_si128(static_cast<int>(p.shift));
+
+      if (p.magic == 0)
+      {
+        const __m512i bias =
+            _mm512_and_si512(_mm512_srai_epi32(n, 31), _mm512_set1_epi32(static_cast<int>((1U << p.shift) - 1)));
+        const __m512i q = _mm512_sra_epi32(_mm512_add_epi32(n, bias), shift);
+        return _mm512_sub_epi32(_mm512_xor_si512(q, sign), sign);
+      }
+
+      const __m512i magic = _mm512_set1_epi32(p.magic);
+      const __m512i even = _mm512_mul_epi32(n, magic);
+      const __m512i odd = _mm512_mul_epi32(_mm512_srli_epi64(n, 32), magic);
+      __m512i hi = _mm512_mask_blend_epi32(0xAAAA, _mm512_srli_epi64(even, 32), odd);
+
+      if (p.add)
+      {
+        hi = _mm512_add_epi32(hi, _mm512_sub_epi32(_mm512_xor_si512(n, sign), sign));
+      }
+
+      const __m512i q = _mm512_sra_epi32(hi, shift);
+      return _mm512_sub_epi32(q, _mm512_srai_epi32(q, 31));
+    }
+
+    template <typename T>
+    CPP_CONCEPT_TARGET("avx512f")
+    void divide_avx512(const Divider &divider, const Params &p, const int *in, T *out, std::size_t n)
+    {
+      std::size_t i = 0;
+      for (; i + 16 <= n; i += 16)
+      {
+        const __m512i q = quotient_avx512(_mm512_loadu_si512(in + i), p);
+
+        if constexpr (std::is_same_v<T, double>)
+        {
+          _mm512_storeu_pd(out + i, _mm512_cvtepi32_pd(_mm512_castsi512_si256(q)));
+          _mm512_storeu_pd(out + i + 8, _mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(q, 1)));
+        }
+        else
+        {
+          _mm512_storeu_si512(out + i, q);
+        }
+      }
+
+      divide_scalar(divider, in, out, i, n);
+    }
+    CPP_CONCEPT_AVX512_END
+#endif
+
+    template <typename T>
+    void divide_batch(const Divider &divider, const Params &p, std::span<const int> in, std::span<T> out)
+    {
+      if (in.size() != out.size())
+      {
+        throw std::invalid_argument("Span sizes must match");
+      }
+
+      const std::size_t n = in.size();
+
+#if CPP_CONCEPT_SIMD_X86
+      switch (simd::isa())
+      {
+      case simd::Isa::avx512:
+        divide_avx512(divider, p, in.data(), out.data(), n);
+        return;
+      case simd::Isa::avx2:
+        divide_avx2(divider, p, in.data(), out.data(), n);
+        return;
+      case simd::Isa::sse2:
+        divide_sse2(divider, p, in.data(), out.data(), n);
+        return;
+      case simd::Isa::scalar:
+        break;
+      }
+#else
+      (void)p;
+#endif
+
+      divide_scalar(divider, in.data(), out.data(), 0, n);
+    }
+
+  } // namespace
+
+  Divider::Divider(int denominator)
+      : denominator_(denominator)
+  {
+    if (denominator == 0)
+    {
+      throw std::invalid_argument("Denominator cannot be zero");
+    }
+
+    const std::uint32_t abs_d =
+        denominator < 0 ? 0U - static_cast<std::uint32_t>(denominator) : static_cast<std::uint32_t>(denominator);
+    const auto floor_log2 = static_cast<std::uint32_t>(31 - std::countl_zero(abs_d));
+    const std::uint8_t sign = denominator < 0 ? negative_divisor : 0;
+
+    if ((abs_d & (abs_d - 1)) == 0)
+    {
+      // Powers of two only need a shift; a zero magic selects that path
+      magic_ = 0;
+      more_ = static_cast<std::uint8_t>(floor_log2 | sign);
+      return;
+    }
+
+    // m = ceil(2^(32 + floor_log2) / |d|), kept in 32 bits by folding the top bit into the add marker
+    const std::uint64_t dividend = std::uint64_t{1} << (floor_log2 - 1 + 32);
+    auto proposed = static_cast<std::uint32_t>(dividend / abs_d);
+    const auto remainder = static_cast<std::uint32_t>(dividend % abs_d);
+    const std::uint32_t error = abs_d - remainder;
+
+    if (error < (std::uint32_t{1} << floor_log2))
+    {
+      more_ = static_cast<std::uint8_t>(floor_log2 - 1);
+    }
+    else
+    {
+      proposed += proposed;
+      const std::uint32_t twice_remainder = remainder + remainder;
+      if (twice_remainder >= abs_d || twice_remainder < remainder)
+      {
+        proposed += 1;
+      }
+      more_ = static_cast<std::uint8_t>(floor_log2 | add_marker);
+    }
+
+    proposed += 1;
+    magic_ = static_cast<std::int32_t>(denominator < 0 ? 0U - proposed : proposed);
+    more_ = static_cast<std::uint8_t>(more_ | sign);
+  }
+
+  void Divider::quotient(std::span<const int> numerators, std::span<int> out) const
+  {
+    const Params p{magic_, static_cast<unsigned>(more_ & shift_mask), (more_ & add_marker) != 0, (more_ & negative_divisor) ? -1 : 0};
+    divide_batch(*this, p, numerators, out);
+  }
+
+  void Divider::divide(std::span<const int> numerators, std::span<double> out) const
+  {
+    const Params p{magic_, static_cast<unsigned>(more_ & shift_mask), (more_ & add_marker) != 0, (more_ & negative_divisor) ? -1 : 0};
+    divide_batch(*this, p, numerators, out);
+  }
+
+} // namespace cpp_concept
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+/**
+ * @file foo/divider.hpp
+ * @brief Header file for the Divider class providing invariant-divisor division.
+ *
+ * This file defines the Divider class within the cpp_concept namespace. A
+ * Divider replaces the hardware integer divide by a precomputed
+ * multiply-high and shift, which pays off whenever many numerators are
+ * divided by the same denominator.
+ *
+ * @author Sentenz
+ * @copyright Copyright (c) 2026 Sentenz
+ * @license SPDX-License-Identifier: Apache-2.0
+ */
+
+namespace cpp_concept
+{
+
+  /**
+   * @brief Divides integers by a fixed denominator without a hardware divide.
+   *
+   * The constructor derives a magic multiplier and shift from the denominator
+   * (Granlund-Montgomery, in the layout popularized by libdivide), and
+   * validates the denominator once. Every subsequent division is a
+   * multiply-high, an optional add and a shift, both in the scalar path and
+   * in the SSE2/AVX2/AVX-512 batch kernels.
+   *
+   * @note Thread safety: A Divider is immutable after construction and safe for
+   *       concurrent read-only access from multiple threads.
+   *
+   * @see Foo::divide()
+   *
+   * @code
+   * Divider by7(7);
+   * int q = by7.quotient(100);    // Returns 14
+   * double d = by7.divide(-100);  // Returns -14.0
+   * @endcode
+   *
+   * @since 1.1
+   */
+  class Divider
+  {
+  public:
+    /**
+     * @brief Precomputes the magic constants for a denominator.
+     *
+     * @param[in] denominator The divisor shared by all later divisions.
+     *
+     * @throws std::invalid_argument If denominator is zero.
+     *
+     * @pre denominator != 0
+     */
+    explicit Divider(int denominator);
+
+    /**
+     * @brief Returns the denominator this divider was built for.
+     *
+     * @return The denominator.
+     */
+    int denominator() const noexcept
+    {
+      return denominator_;
+    }
+
+    /**
+     * @brief Computes the truncated integer quotient.
+     *
+     * @param[in] numerator The dividend.
+     *
+     * @return \f$numerator / denominator\f$ rounded toward zero.
+     *
+     * @note INT_MIN / -1 wraps to INT_MIN instead of trapping.
+     *
+     * @see divide()
+     */
+    int quotient(int numerator) const noexcept
+    {
+      const auto n = static_cast<std::uint32_t>(numerator);
+      const unsigned shift = more_ & shift_mask;
+      const std::uint32_t sign = (more_ & negative_divisor) ? ~std::uint32_t{0} : 0;
+
+      if (magic_ == 0)
+      {
+        // Power of two: bias negative numerators so the arithmetic shift truncates toward zero
+        const std::uint32_t bias = (numerator < 0) ? (std::uint32_t{1} << shift) - 1 : 0;
+        const auto q = static_cast<std::uint32_t>(static_cast<std::int32_t>(n + bias) >> shift);
+        return static_cast<int>((q ^ sign) - sign);
+      }
+
+      const auto product = static_cast<std::int64_t>(magic_) * numerator;
+      auto uq = static_cast<std::uint32_t>(static_cast<std::uint64_t>(product) >> 32);
+      if (more_ & add_marker)
+      {
+        uq += (n ^ sign) - sign;
+      }
+
+      const std::int32_t q = static_cast<std::int32_t>(uq) >> shift;
+      return q + (q < 0 ? 1 : 0);
+    }
+
+    /**
+     * @brief Divides a numerator the same way Foo::divide() does.
+     *
+     * @param[in] numerator The dividend.
+     *
+     * @return The truncated quotient converted to double.
+     *
+     * @see Foo::divide()
+     */
+    double divide(int numerator) const noexcept
+    {
+      return static_cast<double>(quotient(numerator));
+    }
+
+    /**
+     * @brief Computes truncated quotients for a span of numerators.
+     *
+     * @param[in] numerators The dividends.
+     * @param[out] out The destination span receiving the quotients.
+     *
+     * @throws std::invalid_argument If the spans differ in size.
+     *
+     * @pre numerators.size() == out.size()
+     * @note out may alias numerators exactly, but must not partially overlap it.
+     */
+    void quotient(std::span<const int> numerators, std::span<int> out) const;
+
+    /**
+     * @brief Divides a span of numerators the same way Foo::divide() does.
+     *
+     * @param[in] numerators The dividends.
+     * @param[out] out The destination span receiving the quotients as double.
+     *
+     * @throws std::invalid_argument If the spans differ in size.
+     *
+     * @pre numerators.size() == out.size()
+     */
+    void divide(std::span<const int> numerators, std::span<double> out) const;
+
+  private:
+    static constexpr std::uint8_t shift_mask = 0x1F;
+    static constexpr std::uint8_t add_marker = 0x40;
+    static constexpr std::uint8_t negative_divisor = 0x80;
+
+    int denominator_;
+    std::int32_t magic_ = 0;
+    std::uint8_t more_ = 0;
+  };
+
+} // namespace cpp_concept
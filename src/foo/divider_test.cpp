@@ -0,0 +1,183 @@
+#include <gtest/gtest.h>
+
+#include <climits>
+#include <string>
+#include <vector>
+
+#include "foo/divider.hpp"
+#include "foo/foo.hpp"
+
+using namespace cpp_concept;
+
+TEST(DividerTest, Quotient)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      int numerator;
+      int denominator;
+    } in;
+
+    struct Want
+    {
+      int result;
+      bool throws_exception;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"positive division", /* in */ {10, 2}, /* want */ {5, false}},
+      {"division with remainder", /* in */ {7, 2}, /* want */ {3, false}},
+      {"negative truncates toward zero", /* in */ {-7, 2}, /* want */ {-3, false}},
+      {"negative divisor", /* in */ {7, -3}, /* want */ {-2, false}},
+      {"both negative", /* in */ {-7, -3}, /* want */ {2, false}},
+      {"non power of two", /* in */ {100, 7}, /* want */ {14, false}},
+      {"division by one", /* in */ {INT_MIN, 1}, /* want */ {INT_MIN, false}},
+      {"boundary: int max / int max", /* in */ {INT_MAX, INT_MAX}, /* want */ {1, false}},
+      {"boundary: int min / int min", /* in */ {INT_MIN, INT_MIN}, /* want */ {1, false}},
+      {"boundary: int max / int min", /* in */ {INT_MAX, INT_MIN}, /* want */ {0, false}},
+      {"boundary: int min / 7", /* in */ {INT_MIN, 7}, /* want */ {INT_MIN / 7, false}},
+      {"overflow: int min / -1", /* in */ {INT_MIN, -1}, /* want */ {INT_MIN, false}},
+      {"division by zero", /* in */ {10, 0}, /* want */ {0, true}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(Divider{tc.in.denominator}, std::invalid_argument);
+    }
+    else
+    {
+      // Arrange
+      Divider divider(tc.in.denominator);
+
+      // Act
+      auto got = divider.quotient(tc.in.numerator);
+
+      // Assert
+      EXPECT_EQ(got, tc.want.result);
+    }
+  }
+}
+
+TEST(DividerTest, QuotientBatch)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      int denominator;
+    } in;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"one", /* in */ {1}},
+      {"minus one", /* in */ {-1}},
+      {"power of two", /* in */ {16}},
+      {"negative power of two", /* in */ {-1024}},
+      {"small odd", /* in */ {3}},
+      {"add marker", /* in */ {7}},
+      {"negative add marker", /* in */ {-7}},
+      {"large prime", /* in */ {1000003}},
+      {"boundary: int max", /* in */ {INT_MAX}},
+      {"boundary: int min", /* in */ {INT_MIN}},
+  };
+
+  // Numerators spanning both signs, the int limits and a SIMD tail
+  std::vector<int> numerators = {INT_MIN, INT_MIN + 1, INT_MAX, INT_MAX - 1, -1, 0, 1};
+  for (int i = 0; i < 1000; ++i)
+  {
+    numerators.push_back(static_cast<int>(static_cast<unsigned>(i) * 2654435761U));
+  }
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Divider divider(tc.in.denominator);
+    std::vector<int> got(numerators.size());
+
+    // Act
+    divider.quotient(numerators, got);
+
+    // Assert
+    for (std::size_t i = 0; i < numerators.size(); ++i)
+    {
+      if (numerators[i] == INT_MIN && tc.in.denominator == -1)
+      {
+        EXPECT_EQ(got[i], INT_MIN);
+        continue;
+      }
+      EXPECT_EQ(got[i], numerators[i] / tc.in.denominator) << "numerator " << numerators[i];
+    }
+  }
+}
+
+TEST(DividerTest, DivideBatch)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::vector<int> numerators;
+      int denominator;
+      std::size_t out_size;
+    } in;
+
+    struct Want
+    {
+      bool throws_exception;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"empty span", /* in */ {{}, 3, 0}, /* want */ {false}},
+      {"scalar tail", /* in */ {{7, -7, 8}, 2, 3}, /* want */ {false}},
+      {"vector body and tail",
+       /* in */ {{-20, -19, -18, -17, -16, -15, -14, -13, -12, -11, -10, 10, 11, 12, 13, 14, 15, 16, 17}, 3, 19},
+       /* want */ {false}},
+      {"mismatched output", /* in */ {{1, 2}, 3, 1}, /* want */ {true}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+    Divider divider(tc.in.denominator);
+    std::vector<double> got(tc.in.out_size);
+
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(divider.divide(tc.in.numerators, got), std::invalid_argument);
+    }
+    else
+    {
+      divider.divide(tc.in.numerators, got);
+      for (std::size_t i = 0; i < got.size(); ++i)
+      {
+        EXPECT_DOUBLE_EQ(got[i], foo.divide(tc.in.numerators[i], tc.in.denominator));
+      }
+    }
+  }
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+
+/**
+ * @file foo/fibonacci.hpp
+ * @brief Header file for the fast doubling Fibonacci kernel.
+ *
+ * This file defines fibonacci_doubling() within the cpp_concept namespace,
+ * the loop that Foo::fibonacci(), Foo::fibonacci128() and
+ * Foo::fibonacci256() share past their exact tables.
+ *
+ * @author Sentenz
+ * @copyright Copyright (c) 2026 Sentenz
+ * @license SPDX-License-Identifier: Apache-2.0
+ */
+
+namespace cpp_concept
+{
+
+  /**
+   * @brief Computes \f$F(n) \bmod 2^{w}\f$ by fast doubling, where w is the width of T.
+   *
+   * Walks the bits of n from the top down with
+   * \f$F(2k) = F(k) (2F(k+1) - F(k))\f$ and
+   * \f$F(2k+1) = F(k)^2 + F(k+1)^2\f$, so it takes \f$O(\log n)\f$ steps.
+   * Wrapping arithmetic is exact modulo \f$2^{w}\f$, so the result matches
+   * the one of summing the sequence term by term in T.
+   *
+   * @tparam T An unsigned or two's complement integer type with wrapping
+   *           +, - and *, such as std::uint64_t, uint128_t or Int256.
+   *
+   * @param[in] n The index of the Fibonacci number (0-indexed).
+   *
+   * @return \f$F(n)\f$ wrapped to the width of T.
+   *
+   * @since 1.1
+   */
+  template <typename T>
+  constexpr T fibonacci_doubling(std::uint64_t n) noexcept
+  {
+    T a = 0; // F(k)
+    T b = 1; // F(k + 1)
+    for (int bit = std::bit_width(n) - 1; bit >= 0; --bit)
+    {
+      const T even = a * (2 * b - a);
+      const T odd = a * a + b * b;
+      if ((n >> bit) & 1U)
+      {
+        a = odd;
+        b = even + odd;
+      }
+      else
+      {
+        a = even;
+        b = odd;
+      }
+    }
+
+    return a;
+  }
+
+} // namespace cpp_concept
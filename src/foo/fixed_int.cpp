@@ -0,0 +1,72 @@
+#include "foo/fixed_int.hpp"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <ostream>
+
+namespace cpp_concept
+{
+
+  namespace
+  {
+
+    // Largest power of ten in a limb, so decimal output works in groups of 19 digits
+    constexpr std::uint64_t decimal_group = 10000000000000000000ULL;
+    constexpr int decimal_digits = 19;
+
+    // 10^(19 * 5) > 2^256, so five groups hold any magnitude
+    constexpr std::size_t max_groups = 5;
+
+  } // namespace
+
+  std::string Int256::to_string() const
+  {
+    // The magnitude of min() is 2^255, which still fits the unsigned limbs
+    std::array<std::uint64_t, limb_count> magnitude = (is_negative() ? -*this : *this).limbs_;
+
+    std::array<std::uint64_t, max_groups> groups{};
+    std::size_t count = 0;
+    std::size_t size = limb_count;
+    while (size > 0 && magnitude[size - 1] == 0)
+    {
+      --size;
+    }
+    while (size > 0)
+    {
+      std::uint64_t remainder = 0;
+      for (std::size_t i = size; i-- > 0;)
+      {
+        const uint128_t current = (uint128_t{remainder} << 64) | magnitude[i];
+        magnitude[i] = static_cast<std::uint64_t>(current / decimal_group);
+        remainder = static_cast<std::uint64_t>(current % decimal_group);
+      }
+      groups[count++] = remainder;
+      while (size > 0 && magnitude[size - 1] == 0)
+      {
+        --size;
+      }
+    }
+
+    std::string result = is_negative() ? "-" : "";
+    std::array<char, decimal_digits> digits;
+    for (std::size_t i = std::max<std::size_t>(count, 1); i-- > 0;)
+    {
+      const auto end = std::to_chars(digits.data(), digits.data() + digits.size(), groups[i]).ptr;
+      const auto length = static_cast<std::size_t>(end - digits.data());
+      if (i + 1 < count)
+      {
+        result.append(digits.size() - length, '0');
+      }
+      result.append(digits.data(), length);
+    }
+
+    return result;
+  }
+
+  std::ostream &operator<<(std::ostream &os, const Int256 &value)
+  {
+    return os << value.to_string();
+  }
+
+} // namespace cpp_concept
@@ -0,0 +1,381 @@
+#pragma once
+
+#include "foo/int128.hpp"
+
+#include <array>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <type_traits>
+
+/**
+ * @file foo/fixed_int.hpp
+ * @brief Header file for the fixed-width 128-bit and 256-bit integer types.
+ *
+ * This file defines the Int256 class within the cpp_concept namespace and
+ * pulls in the uint128_t alias. Both have a fixed size, live entirely on the
+ * stack and work in constant expressions, so they widen the exact range of
+ * the Foo arithmetic without the allocations of BigInt.
+ *
+ * @author Sentenz
+ * @copyright Copyright (c) 2026 Sentenz
+ * @license SPDX-License-Identifier: Apache-2.0
+ */
+
+namespace cpp_concept
+{
+
+  /**
+   * @brief A built-in integer type that stands for a number.
+   *
+   * std::integral without bool and the character types, which would
+   * otherwise convert silently to a number. signed char and unsigned char
+   * stay included, since they back std::int8_t and std::uint8_t.
+   */
+  template <typename T>
+  concept NumericIntegral =
+      std::integral<T> && !std::same_as<std::remove_cv_t<T>, bool> && !std::same_as<std::remove_cv_t<T>, char> &&
+      !std::same_as<std::remove_cv_t<T>, wchar_t> && !std::same_as<std::remove_cv_t<T>, char8_t> &&
+      !std::same_as<std::remove_cv_t<T>, char16_t> && !std::same_as<std::remove_cv_t<T>, char32_t>;
+
+  /**
+   * @brief Signed 256-bit two's complement integer.
+   *
+   * Holds four 64-bit limbs, least significant first. Sums and differences
+   * run as one add-with-carry chain through the compiler's adc and sbb
+   * builtins on x86-64, and each partial product is one
+   * 64 x 64 -> 128-bit multiply, which compiles to mul, or mulx where BMI2 is
+   * enabled. Constant evaluation takes portable 128-bit arithmetic instead,
+   * so every operation also works in constant expressions. Arithmetic wraps
+   * modulo \f$2^{256}\f$ like the built-in unsigned types, so overflow is
+   * defined, not undefined.
+   *
+   * @note Thread safety: Int256 is a value type; distinct objects may be used
+   *       concurrently.
+   *
+   * @see Foo::factorial256()
+   * @see Foo::fibonacci256()
+   *
+   * @code
+   * constexpr Int256 x = Int256(1) << 200;
+   * static_assert(x * x == 0);       // 2^400 wraps to zero
+   * std::cout << -x << '\n';         // -1606938044258990275541962092341162602522202993782792835301376
+   * @endcode
+   *
+   * @since 1.1
+   */
+  class Int256
+  {
+  public:
+    /// Number of 64-bit limbs.
+    static constexpr std::size_t limb_count = 4;
+
+    /**
+     * @brief Constructs zero.
+     */
+    constexpr Int256() noexcept = default;
+
+    /**
+     * @brief Constructs the value of a built-in integer, sign-extending signed types.
+     *
+     * Implicit, so built-in operands mix with Int256 in expressions. bool
+     * and the character types are rejected, see NumericIntegral.
+     *
+     * @param[in] value The initial value.
+     */
+    template <NumericIntegral T>
+    constexpr Int256(T value) noexcept
+        : limbs_{static_cast<std::uint64_t>(value)}
+    {
+      if constexpr (std::signed_integral<T>)
+      {
+        if (value < 0)
+        {
+          limbs_[1] = limbs_[2] = limbs_[3] = ~std::uint64_t{0};
+        }
+      }
+    }
+
+    /**
+     * @brief Rejects bool and the character types, which the uint128_t
+     *        constructor would otherwise take by integral conversion.
+     */
+    template <std::integral T>
+      requires(!NumericIntegral<T>)
+    Int256(T value) = delete;
+
+    /**
+     * @brief Constructs the value of an unsigned 128-bit integer.
+     *
+     * @param[in] value The initial value.
+     */
+    constexpr Int256(uint128_t value) noexcept
+        : limbs_{static_cast<std::uint64_t>(value), static_cast<std::uint64_t>(value >> 64)}
+    {
+    }
+
+    /**
+     * @brief Constructs a value from its two's complement limbs.
+     *
+     * @param[in] limbs The limbs, least significant first.
+     */
+    static constexpr Int256 from_limbs(const std::array<std::uint64_t, limb_count> &limbs) noexcept
+    {
+      Int256 result;
+      result.limbs_ = limbs;
+
+      return result;
+    }
+
+    /**
+     * @brief Returns the largest value, \f$2^{255} - 1\f$.
+     */
+    static constexpr Int256 max() noexcept
+    {
+      return from_limbs({~std::uint64_t{0}, ~std::uint64_t{0}, ~std::uint64_t{0}, ~std::uint64_t{0} >> 1});
+    }
+
+    /**
+     * @brief Returns the smallest value, \f$-2^{255}\f$.
+     */
+    static constexpr Int256 min() noexcept
+    {
+      return from_limbs({0, 0, 0, std::uint64_t{1} << 63});
+    }
+
+    /**
+     * @brief Returns the two's complement limbs, least significant first.
+     */
+    constexpr const std::array<std::uint64_t, limb_count> &limbs() const noexcept
+    {
+      return limbs_;
+    }
+
+    /**
+     * @brief Checks whether the value is below zero.
+     */
+    constexpr bool is_negative() const noexcept
+    {
+      return (limbs_[limb_count - 1] >> 63) != 0;
+    }
+
+    /**
+     * @brief Returns the low 128 bits, which is the value itself if it is in \f$[0, 2^{128})\f$.
+     */
+    constexpr uint128_t low128() const noexcept
+    {
+      return (uint128_t{limbs_[1]} << 64) | limbs_[0];
+    }
+
+    constexpr Int256 &operator+=(const Int256 &other) noexcept
+    {
+      // Unrolled, so the carry stays in the flags from one limb to the next
+      unsigned char carry = add_carry(0, limbs_[0], other.limbs_[0], limbs_[0]);
+      carry = add_carry(carry, limbs_[1], other.limbs_[1], limbs_[1]);
+      carry = add_carry(carry, limbs_[2], other.limbs_[2], limbs_[2]);
+      add_carry(carry, limbs_[3], other.limbs_[3], limbs_[3]);
+
+      return *this;
+    }
+
+    constexpr Int256 &operator-=(const Int256 &other) noexcept
+    {
+      unsigned char borrow = subtract_borrow(0, limbs_[0], other.limbs_[0], limbs_[0]);
+      borrow = subtract_borrow(borrow, limbs_[1], other.limbs_[1], limbs_[1]);
+      borrow = subtract_borrow(borrow, limbs_[2], other.limbs_[2], limbs_[2]);
+      subtract_borrow(borrow, limbs_[3], other.limbs_[3], limbs_[3]);
+
+      return *this;
+    }
+
+    /**
+     * @brief Multiplies in place modulo \f$2^{256}\f$.
+     *
+     * Forms only the ten partial products that reach the low four limbs, row
+     * by row; two's complement makes the signed and unsigned products agree
+     * there. A partial product plus two limbs never exceeds 128 bits.
+     */
+    constexpr Int256 &operator*=(const Int256 &other) noexcept
+    {
+      const auto &a = limbs_;
+      const auto &b = other.limbs_;
+
+      uint128_t t = uint128_t{a[0]} * b[0];
+      std::uint64_t r0 = static_cast<std::uint64_t>(t);
+      t = uint128_t{a[0]} * b[1] + static_cast<std::uint64_t>(t >> 64);
+      std::uint64_t r1 = static_cast<std::uint64_t>(t);
+      t = uint128_t{a[0]} * b[2] + static_cast<std::uint64_t>(t >> 64);
+      std::uint64_t r2 = static_cast<std::uint64_t>(t);
+      std::uint64_t r3 = a[0] * b[3] + static_cast<std::uint64_t>(t >> 64);
+
+      t = uint128_t{a[1]} * b[0] + r1;
+      r1 = static_cast<std::uint64_t>(t);
+      t = uint128_t{a[1]} * b[1] + r2 + static_cast<std::uint64_t>(t >> 64);
+      r2 = static_cast<std::uint64_t>(t);
+      r3 += a[1] * b[2] + static_cast<std::uint64_t>(t >> 64);
+
+      t = uint128_t{a[2]} * b[0] + r2;
+      r2 = static_cast<std::uint64_t>(t);
+      r3 += a[2] * b[1] + static_cast<std::uint64_t>(t >> 64);
+
+      r3 += a[3] * b[0];
+      limbs_ = {r0, r1, r2, r3};
+
+      return *this;
+    }
+
+    /**
+     * @brief Shifts left in place; bits shifted past bit 255 are lost.
+     *
+     * @pre bits < 256
+     */
+    constexpr Int256 &operator<<=(unsigned bits) noexcept
+    {
+      const std::size_t words = bits / 64;
+      const unsigned shift = bits % 64;
+      for (std::size_t i = limb_count; i-- > 0;)
+      {
+        const std::uint64_t lo = i >= words ? limbs_[i - words] << shift : 0;
+        const std::uint64_t hi = shift != 0 && i > words ? limbs_[i - words - 1] >> (64 - shift) : 0;
+        limbs_[i] = lo | hi;
+      }
+
+      return *this;
+    }
+
+    /**
+     * @brief Shifts right in place, copying the sign bit in from the left.
+     *
+     * @pre bits < 256
+     */
+    constexpr Int256 &operator>>=(unsigned bits) noexcept
+    {
+      const std::uint64_t fill = is_negative() ? ~std::uint64_t{0} : 0;
+      const std::size_t words = bits / 64;
+      const unsigned shift = bits % 64;
+      for (std::size_t i = 0; i < limb_count; ++i)
+      {
+        const std::uint64_t lo = i + words < limb_count ? limbs_[i + words] : fill;
+        const std::uint64_t hi = i + words + 1 < limb_count ? limbs_[i + words + 1] : fill;
+        limbs_[i] = shift != 0 ? (lo >> shift) | (hi << (64 - shift)) : lo;
+      }
+
+      return *this;
+    }
+
+    constexpr Int256 operator-() const noexcept
+    {
+      return Int256() - *this;
+    }
+
+    friend constexpr Int256 operator+(Int256 a, const Int256 &b) noexcept
+    {
+      return a += b;
+    }
+
+    friend constexpr Int256 operator-(Int256 a, const Int256 &b) noexcept
+    {
+      return a -= b;
+    }
+
+    friend constexpr Int256 operator*(Int256 a, const Int256 &b) noexcept
+    {
+      return a *= b;
+    }
+
+    friend constexpr Int256 operator<<(Int256 a, unsigned bits) noexcept
+    {
+      return a <<= bits;
+    }
+
+    friend constexpr Int256 operator>>(Int256 a, unsigned bits) noexcept
+    {
+      return a >>= bits;
+    }
+
+    friend constexpr bool operator==(const Int256 &a, const Int256 &b) noexcept = default;
+
+    friend constexpr std::strong_ordering operator<=>(const Int256 &a, const Int256 &b) noexcept
+    {
+      if (a.is_negative() != b.is_negative())
+      {
+        return a.is_negative() ? std::strong_ordering::less : std::strong_ordering::greater;
+      }
+
+      // Same sign, so the two's complement limbs order like unsigned ones
+      for (std::size_t i = limb_count; i-- > 0;)
+      {
+        if (a.limbs_[i] != b.limbs_[i])
+        {
+          return a.limbs_[i] <=> b.limbs_[i];
+        }
+      }
+
+      return std::strong_ordering::equal;
+    }
+
+    /**
+     * @brief Returns the decimal representation, with a leading '-' if negative.
+     */
+    std::string to_string() const;
+
+    /**
+     * @brief Writes the value in decimal.
+     */
+    friend std::ostream &operator<<(std::ostream &os, const Int256 &value);
+
+  private:
+    // out = a + b + carry; returns the carry out. The builtin compiles to
+    // adc without pulling <immintrin.h> into this public header, while
+    // constant evaluation takes the portable 128-bit sum
+    static constexpr unsigned char add_carry(unsigned char carry, std::uint64_t a, std::uint64_t b,
+                                             std::uint64_t &out) noexcept
+    {
+#if defined(__x86_64__) && __has_builtin(__builtin_ia32_addcarryx_u64)
+      if !consteval
+      {
+        unsigned long long sum = 0;
+        carry = __builtin_ia32_addcarryx_u64(carry, a, b, &sum);
+        out = sum;
+        return carry;
+      }
+#endif
+      const uint128_t sum = uint128_t{a} + b + carry;
+      out = static_cast<std::uint64_t>(sum);
+      return static_cast<unsigned char>(sum >> 64);
+    }
+
+    // out = a - b - borrow; returns the borrow out, as sbb
+    static constexpr unsigned char subtract_borrow(unsigned char borrow, std::uint64_t a, std::uint64_t b,
+                                                   std::uint64_t &out) noexcept
+    {
+#if defined(__x86_64__) && __has_builtin(__builtin_ia32_sbb_u64)
+      if !consteval
+      {
+        unsigned long long difference = 0;
+        borrow = __builtin_ia32_sbb_u64(borrow, a, b, &difference);
+        out = difference;
+        return borrow;
+      }
+#elif defined(__x86_64__) && __has_builtin(__builtin_ia32_subborrow_u64)
+      // Clang spells the same sbb builtin differently
+      if !consteval
+      {
+        unsigned long long difference = 0;
+        borrow = __builtin_ia32_subborrow_u64(borrow, a, b, &difference);
+        out = difference;
+        return borrow;
+      }
+#endif
+      const uint128_t difference = uint128_t{a} - b - borrow;
+      out = static_cast<std::uint64_t>(difference);
+      return static_cast<unsigned char>((difference >> 64) & 1U);
+    }
+
+    std::array<std::uint64_t, limb_count> limbs_{};
+  };
+
+} // namespace cpp_concept
@@ -0,0 +1,244 @@
+#include <gtest/gtest.h>
+
+#include <compare>
+#include <cstdint>
+#include <random>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "foo/fixed_int.hpp"
+
+using namespace cpp_concept;
+
+TEST(Int256Test, Arithmetic)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      Int256 a;
+      Int256 b;
+    } in;
+
+    struct Want
+    {
+      std::string sum;
+      std::string difference;
+      std::string product;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"zero", /* in */ {0, 0}, /* want */ {"0", "0", "0"}},
+      {"mixed signs", /* in */ {123456789, -987654321}, /* want */ {"-864197532", "1111111110", "-121932631112635269"}},
+      {"carry through three limbs", /* in */ {Int256::from_limbs({~0ULL, ~0ULL, ~0ULL, 0}), 1}, /* want */ {"6277101735386680763835789423207666416102355444464034512896", "6277101735386680763835789423207666416102355444464034512894", "6277101735386680763835789423207666416102355444464034512895"}},
+      {"largest 64-bit square", /* in */ {~0ULL, ~0ULL}, /* want */ {"36893488147419103230", "0", "340282366920938463426481119284349108225"}},
+      {"overflow: max plus one wraps to min", /* in */ {Int256::max(), 1}, /* want */ {"-57896044618658097711785492504343953926634992332820282019728792003956564819968", "57896044618658097711785492504343953926634992332820282019728792003956564819966", "57896044618658097711785492504343953926634992332820282019728792003956564819967"}},
+      {"overflow: min times minus one is min", /* in */ {Int256::min(), -1}, /* want */ {"57896044618658097711785492504343953926634992332820282019728792003956564819967", "-57896044618658097711785492504343953926634992332820282019728792003956564819967", "-57896044618658097711785492504343953926634992332820282019728792003956564819968"}},
+      {"overflow: 2^256 wraps to zero", /* in */ {Int256(1) << 128, Int256(1) << 128}, /* want */ {"680564733841876926926749214863536422912", "0", "0"}},
+      {"overflow: product keeps the low 256 bits", /* in */ {(Int256(1) << 200) + 7, (Int256(1) << 100) - 3}, /* want */ {"1606938044258990275541962092342430253122431223184289538506756", "1606938044258990275541962092339894951921974764381296132096010", "-4820814132776970826625886277014614253365011375537901583466517"}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Act
+    auto sum = tc.in.a + tc.in.b;
+    auto difference = tc.in.a - tc.in.b;
+    auto product = tc.in.a * tc.in.b;
+
+    // Assert
+    EXPECT_EQ(sum.to_string(), tc.want.sum);
+    EXPECT_EQ(difference.to_string(), tc.want.difference);
+    EXPECT_EQ(product.to_string(), tc.want.product);
+    EXPECT_EQ(tc.in.b * tc.in.a, product);
+    EXPECT_EQ(-tc.in.b + tc.in.a, difference);
+  }
+}
+
+TEST(Int256Test, ArithmeticMatchesRingLaws)
+{
+  // Arrange
+  std::mt19937_64 engine(256);
+  auto random = [&engine]
+  {
+    return Int256::from_limbs({engine(), engine(), engine(), engine()});
+  };
+
+  for (int i = 0; i < 1000; ++i)
+  {
+    const Int256 a = random();
+    const Int256 b = random();
+    const Int256 c = random();
+
+    // Act & Assert
+    EXPECT_EQ(a + b - b, a);
+    EXPECT_EQ((a + b) + c, a + (b + c));
+    EXPECT_EQ((a * b) * c, a * (b * c));
+    EXPECT_EQ(a * (b + c), a * b + a * c);
+    EXPECT_EQ(a * 8, a << 3);
+  }
+}
+
+TEST(Int256Test, Shift)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      Int256 value;
+      unsigned bits;
+    } in;
+
+    struct Want
+    {
+      std::string left;
+      std::string right;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"shift by zero", /* in */ {1, 0}, /* want */ {"1", "1"}},
+      {"into the sign bit", /* in */ {1, 255}, /* want */ {"-57896044618658097711785492504343953926634992332820282019728792003956564819968", "0"}},
+      {"whole limb of a negative value", /* in */ {-1, 64}, /* want */ {"-18446744073709551616", "-1"}},
+      {"across limbs, high bits lost", /* in */ {(Int256(1) << 250) + 12345, 70}, /* want */ {"14574403557756442540769280", "1532495540865888858358347027150309183618739122183602176"}},
+      {"negative value rounds toward minus infinity", /* in */ {-(Int256(1) << 200) - 1, 130}, /* want */ {"-1361129467683753853853498429727072845824", "-1180591620717411303425"}},
+      {"out of the low limb", /* in */ {std::uint64_t{1} << 63, 1}, /* want */ {"18446744073709551616", "4611686018427387904"}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Act & Assert
+    EXPECT_EQ((tc.in.value << tc.in.bits).to_string(), tc.want.left);
+    EXPECT_EQ((tc.in.value >> tc.in.bits).to_string(), tc.want.right);
+  }
+}
+
+TEST(Int256Test, Compare)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      Int256 a;
+      Int256 b;
+    } in;
+
+    struct Want
+    {
+      std::strong_ordering order;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"equal", /* in */ {42, 42}, /* want */ {std::strong_ordering::equal}},
+      {"negative below positive", /* in */ {-1, 1}, /* want */ {std::strong_ordering::less}},
+      {"both negative", /* in */ {-2, -1}, /* want */ {std::strong_ordering::less}},
+      {"differs in the high limb", /* in */ {Int256(1) << 192, ~0ULL}, /* want */ {std::strong_ordering::greater}},
+      {"min below max", /* in */ {Int256::min(), Int256::max()}, /* want */ {std::strong_ordering::less}},
+      {"max above 128-bit value", /* in */ {Int256::max(), ~uint128_t{0}}, /* want */ {std::strong_ordering::greater}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Act & Assert
+    EXPECT_EQ(tc.in.a <=> tc.in.b, tc.want.order);
+    EXPECT_EQ(tc.in.a == tc.in.b, tc.want.order == std::strong_ordering::equal);
+  }
+}
+
+TEST(Int256Test, ToString)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      Int256 value;
+    } in;
+
+    struct Want
+    {
+      std::string text;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"zero", /* in */ {0}, /* want */ {"0"}},
+      {"minus one", /* in */ {-1}, /* want */ {"-1"}},
+      {"smallest two-group value", /* in */ {10000000000000000000ULL}, /* want */ {"10000000000000000000"}},
+      {"zero-padded inner group", /* in */ {uint128_t{10000000000000000000ULL} * 10000000000000000000ULL + 1}, /* want */ {"100000000000000000000000000000000000001"}},
+      {"max", /* in */ {Int256::max()}, /* want */ {"57896044618658097711785492504343953926634992332820282019728792003956564819967"}},
+      {"min", /* in */ {Int256::min()}, /* want */ {"-57896044618658097711785492504343953926634992332820282019728792003956564819968"}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Act
+    std::ostringstream os;
+    os << tc.in.value;
+
+    // Assert
+    EXPECT_EQ(tc.in.value.to_string(), tc.want.text);
+    EXPECT_EQ(os.str(), tc.want.text);
+  }
+}
+
+TEST(Int256Test, ConvertingConstructor)
+{
+  // Act & Assert
+  static_assert(std::is_convertible_v<std::int8_t, Int256>);
+  static_assert(std::is_convertible_v<std::uint8_t, Int256>);
+  static_assert(std::is_convertible_v<uint128_t, Int256>);
+  // bool and the character types are not numbers, so they do not convert
+  static_assert(!std::is_constructible_v<Int256, bool>);
+  static_assert(!std::is_constructible_v<Int256, char>);
+  static_assert(!std::is_constructible_v<Int256, char32_t>);
+  EXPECT_EQ(Int256(std::int8_t{-3}), -Int256(3));
+}
+
+TEST(Int256Test, ConstantEvaluation)
+{
+  // Arrange
+  constexpr Int256 x = Int256(1) << 200;
+  constexpr Int256 y = Int256::max() + 1;
+  constexpr Int256 z = Int256(~0ULL) * ~0ULL - 1;
+
+  // Act & Assert
+  static_assert(x * x == 0);
+  static_assert(y == Int256::min());
+  static_assert(z.low128() == ~uint128_t{0} << 65);
+  static_assert((x >> 200) == 1 && (-x >> 201) == -1);
+  static_assert(-x < 0 && 0 < x);
+
+  // The folded values agree with run-time evaluation
+  Int256 runtime = 1;
+  runtime <<= 200;
+  EXPECT_EQ(runtime, x);
+  EXPECT_EQ(runtime * runtime, x * x);
+  EXPECT_EQ(Int256(~0ULL) * ~0ULL - 1, z);
+}
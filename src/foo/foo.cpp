@@ -1,25 +1,1823 @@
 #include "foo/foo.hpp"
+#include "foo/divider.hpp"
+#include "foo/modular.hpp"
+#include "foo/parallel.hpp"
+#include "foo/sieve.hpp"
+#include "foo/simd.hpp"
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <numeric>
 #include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace cpp_concept
 {
 
+  namespace
+  {
+
+    enum class Op
+    {
+      add,
+      subtract,
+      multiply
+    };
+
+    // NOTE Lanes are computed in unsigned arithmetic so that overflow wraps with
+    // defined behavior and matches the vector instructions bit for bit.
+    template <Op op>
+    int apply(int a, int b)
+    {
+      const auto ua = static_cast<unsigned>(a);
+      const auto ub = static_cast<unsigned>(b);
+
+      if constexpr (op == Op::add)
+      {
+        return static_cast<int>(ua + ub);
+      }
+      else if constexpr (op == Op::subtract)
+      {
+        return static_cast<int>(ua - ub);
+      }
+      else
+      {
+        return static_cast<int>(ua * ub);
+      }
+    }
+
+    template <Op op>
+    void kernel_scalar(const int *a, const int *b, int *out, std::size_t n)
+    {
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        out[i] = apply<op>(a[i], b[i]);
+      }
+    }
+
+#if CPP_CONCEPT_SIMD_X86
+    template <Op op>
+    CPP_CONCEPT_TARGET("sse2")
+    void kernel_sse2(const int *a, const int *b, int *out, std::size_t n)
+    {
+      std::size_t i = 0;
+      for (; i + 4 <= n; i += 4)
+      {
+        const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i));
+        const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + i));
+        __m128i vr;
+
+        if constexpr (op == Op::add)
+        {
+          vr = _mm_add_epi32(va, vb);
+        }
+        else if constexpr (op == Op::subtract)
+        {
+          vr = _mm_sub_epi32(va, vb);
+        }
+        else
+        {
+          // SSE2 lacks a 32-bit low multiply, so multiply even and odd lanes as
+          // 64-bit products and interleave their low halves
+          const __m128i even = _mm_mul_epu32(va, vb);
+          const __m128i odd = _mm_mul_epu32(_mm_srli_epi64(va, 32), _mm_srli_epi64(vb, 32));
+          vr = _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                                  _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), vr);
+      }
+
+      kernel_scalar<op>(a + i, b + i, out + i, n - i);
+    }
+
+    template <Op op>
+    CPP_CONCEPT_TARGET("avx2")
+    void kernel_avx2(const int *a, const int *b, int *out, std::size_t n)
+    {
+      std::size_t i = 0;
+      for (; i + 8 <= n; i += 8)
+      {
+        const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+        const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+        __m256i vr;
+
+        if constexpr (op == Op::add)
+        {
+          vr = _mm256_add_epi32(va, vb);
+        }
+        else if constexpr (op == Op::subtract)
+        {
+          vr = _mm256_sub_epi32(va, vb);
+        }
+        else
+        {
+          vr = _mm256_mullo_epi32(va, vb);
+        }
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i), vr);
+      }
+
+      kernel_scalar<op>(a + i, b + i, out + i, n - i);
+    }
+
+    template <Op op>
+    CPP_CONCEPT_TARGET("avx512f")
+    void kernel_avx512(const int *a, const int *b, int *out, std::size_t n)
+    {
+      std::size_t i = 0;
+      for (; i + 16 <= n; i += 16)
+      {
+        const __m512i va = _mm512_loadu_si512(a + i);
+        const __m512i vb = _mm512_loadu_si512(b + i);
+        __m512i vr;
+
+        if constexpr (op == Op::add)
+        {
+          vr = _mm512_add_epi32(va, vb);
+        }
+        else if constexpr (op == Op::subtract)
+        {
+          vr = _mm512_sub_epi32(va, vb);
+        }
+        else
+        {
+          vr = _mm512_mullo_epi32(va, vb);
+        }
+
+        _mm512_storeu_si512(out + i, vr);
+      }
+
+      kernel_scalar<op>(a + i, b + i, out + i, n - i);
+    }
+#endif
+
+    template <Op op>
+    void batch(std::span<const int> a, std::span<const int> b, std::span<int> out)
+    {
+      if (a.size() != b.size() || a.size() != out.size())
+      {
+        throw std::invalid_argument("Span sizes must match");
+      }
+
+      const std::size_t n = out.size();
+
+#if CPP_CONCEPT_SIMD_X86
+      switch (simd::isa())
+      {
+      case simd::Isa::avx512:
+        kernel_avx512<op>(a.data(), b.data(), out.data(), n);
+        return;
+      case simd::Isa::avx2:
+        kernel_avx2<op>(a.data(), b.data(), out.data(), n);
+        return;
+      case simd::Isa::sse2:
+        kernel_sse2<op>(a.data(), b.data(), out.data(), n);
+        return;
+      case simd::Isa::scalar:
+        break;
+      }
+#endif
+
+      kernel_scalar<op>(a.data(), b.data(), out.data(), n);
+    }
+
+    enum class Mode
+    {
+      checked,
+      saturating
+    };
+
+    // NOTE The exact result of any two int operands fits in 64 bits, so overflow
+    // is detected without branches by comparing against the narrowed value
+    template <Op op>
+    std::int64_t exact(int a, int b)
+    {
+      const auto wa = static_cast<std::int64_t>(a);
+      const auto wb = static_cast<std::int64_t>(b);
+
+      if constexpr (op == Op::add)
+      {
+        return wa + wb;
+      }
+      else if constexpr (op == Op::subtract)
+      {
+        return wa - wb;
+      }
+      else
+      {
+        return wa * wb;
+      }
+    }
+
+    template <Op op>
+    bool checked(int a, int b, int &result)
+    {
+      const std::int64_t wide = exact<op>(a, b);
+      result = apply<op>(a, b);
+      return wide != result;
+    }
+
+    template <Op op>
+    int saturating(int a, int b)
+    {
+      return static_cast<int>(std::clamp<std::int64_t>(exact<op>(a, b), INT_MIN, INT_MAX));
+    }
+
+    // Accumulates lane overflow bits into 64-bit words and flushes each word once
+    // it is complete, so the mask is written sequentially alongside the results
+    struct MaskWriter
+    {
+      std::uint64_t *words;
+      std::uint64_t word = 0;
+      std::size_t count = 0;
+
+      void put(std::size_t lane, std::uint64_t bits, std::size_t width)
+      {
+        word |= bits << (lane & 63);
+        if (((lane + width) & 63) == 0)
+        {
+          flush(lane);
+        }
+      }
+
+      void flush(std::size_t lane)
+      {
+        words[lane >> 6] = word;
+        count += static_cast<std::size_t>(std::popcount(word));
+        word = 0;
+      }
+    };
+
+    template <Op op, Mode mode>
+    void overflow_scalar(const int *a, const int *b, int *out, std::size_t first, std::size_t n, MaskWriter &mask)
+    {
+      for (std::size_t i = first; i < n; ++i)
+      {
+        if constexpr (mode == Mode::checked)
+        {
+          const bool overflowed = checked<op>(a[i], b[i], out[i]);
+          mask.put(i, overflowed ? 1 : 0, 1);
+        }
+        else
+        {
+          out[i] = saturating<op>(a[i], b[i]);
+        }
+      }
+
+      if constexpr (mode == Mode::checked)
+      {
+        if ((n & 63) != 0)
+        {
+          mask.flush(n - 1);
+        }
+      }
+    }
+
+#if CPP_CONCEPT_SIMD_X86
+    template <Op op, Mode mode>
+    CPP_CONCEPT_TARGET("avx2")
+    void overflow_avx2(const int *a, const int *b, int *out, std::size_t n, MaskWriter &mask)
+    {
+      const __m256i int_max = _mm256_set1_epi32(INT_MAX);
+
+      std::size_t i = 0;
+      for (; i + 8 <= n; i += 8)
+      {
+        const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+        const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+        __m256i vr;
+        __m256i overflowed;
+        __m256i sign;
+
+        if constexpr (op == Op::add)
+        {
+          // Overflow iff both operands share a sign that the sum does not
+          vr = _mm256_add_epi32(va, vb);
+          overflowed = _mm256_srai_epi32(_mm256_and_si256(_mm256_xor_si256(va, vr), _mm256_xor_si256(vb, vr)), 31);
+          sign = va;
+        }
+        else if constexpr (op == Op::subtract)
+        {
+          // Overflow iff the operands differ in sign and the difference flips the minuend's sign
+          vr = _mm256_sub_epi32(va, vb);
+          overflowed = _mm256_srai_epi32(_mm256_and_si256(_mm256_xor_si256(va, vb), _mm256_xor_si256(va, vr)), 31);
+          sign = va;
+        }
+        else
+        {
+          // Form the exact 64-bit products of even and odd lanes; a lane overflowed
+          // when the high half is not the sign extension of the low half
+          vr = _mm256_mullo_epi32(va, vb);
+          const __m256i even = _mm256_mul_epi32(va, vb);
+          const __m256i odd = _mm256_mul_epi32(_mm256_srli_epi64(va, 32), _mm256_srli_epi64(vb, 32));
+          const __m256i even_ok =
+              _mm256_cmpeq_epi32(even, _mm256_shuffle_epi32(_mm256_srai_epi32(even, 31), _MM_SHUFFLE(2, 2, 0, 0)));
+          const __m256i odd_ok =
+              _mm256_cmpeq_epi32(odd, _mm256_shuffle_epi32(_mm256_srai_epi32(odd, 31), _MM_SHUFFLE(2, 2, 0, 0)));
+          const __m256i ok = _mm256_blend_epi32(_mm256_srli_epi64(even_ok, 32), odd_ok, 0xAA);
+          overflowed = _mm256_xor_si256(ok, _mm256_set1_epi32(-1));
+          sign = _mm256_xor_si256(va, vb);
+        }
+
+        if constexpr (mode == Mode::checked)
+        {
+          const auto bits = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(overflowed)));
+          mask.put(i, bits, 8);
+        }
+        else
+        {
+          const __m256i bound = _mm256_xor_si256(_mm256_srai_epi32(sign, 31), int_max);
+          vr = _mm256_blendv_epi8(vr, bound, overflowed);
+        }
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i), vr);
+      }
+
+      overflow_scalar<op, mode>(a, b, out, i, n, mask);
+    }
+
+    CPP_CONCEPT_AVX512_BEGIN
+    template <Op op, Mode mode>
+    CPP_CONCEPT_TARGET("avx512f")
+    void overflow_avx512(const int *a, const int *b, int *out, std::size_t n, MaskWriter &mask)
+    {
+      const __m512i int_max = _mm512_set1_epi32(INT_MAX);
+      const __m512i zero = _mm512_setzero_si512();
+
+      std::size_t i = 0;
+      for (; i + 16 <= n; i += 16)
+      {
+        const __m512i va = _mm512_loadu_si512(a + i);
+        const __m512i vb = _mm512_loadu_si512(b + i);
+        __m512i vr;
+        __mmask16 overflowed;
+        __m512i sign;
+
+        if constexpr (op == Op::add)
+        {
+          vr = _mm512_add_epi32(va, vb);
+          overflowed = _mm512_cmplt_epi32_mask(_mm512_and_si512(_mm512_xor_si512(va, vr), _mm512_xor_si512(vb, vr)), zero);
+          sign = va;
+        }
+        else if constexpr (op == Op::subtract)
+        {
+          vr = _mm512_sub_epi32(va, vb);
+          overflowed = _mm512_cmplt_epi32_mask(_mm512_and_si512(_mm512_xor_si512(va, vb), _mm512_xor_si512(va, vr)), zero);
+          sign = va;
+        }
+        else
+        {
+          // The compare of each 64-bit product lands in the odd mask bit of its pair
+          vr = _mm512_mullo_epi32(va, vb);
+          const __m512i even = _mm512_mul_epi32(va, vb);
+          const __m512i odd = _mm512_mul_epi32(_mm512_srli_epi64(va, 32), _mm512_srli_epi64(vb, 32));
+          const __mmask16 even_ok =
+              _mm512_cmpeq_epi32_mask(even, _mm512_shuffle_epi32(_mm512_srai_epi32(even, 31), _MM_PERM_CCAA));
+          const __mmask16 odd_ok =
+              _mm512_cmpeq_epi32_mask(odd, _mm512_shuffle_epi32(_mm512_srai_epi32(odd, 31), _MM_PERM_CCAA));
+          overflowed = static_cast<__mmask16>(((~even_ok >> 1) & 0x5555) | (~odd_ok & 0xAAAA));
+          sign = _mm512_xor_si512(va, vb);
+        }
+
+        if constexpr (mode == Mode::checked)
+        {
+          mask.put(i, overflowed, 16);
+        }
+        else
+        {
+          const __m512i bound = _mm512_xor_si512(_mm512_srai_epi32(sign, 31), int_max);
+          vr = _mm512_mask_mov_epi32(vr, overflowed, bound);
+        }
+
+        _mm512_storeu_si512(out + i, vr);
+      }
+
+      overflow_scalar<op, mode>(a, b, out, i, n, mask);
+    }
+    CPP_CONCEPT_AVX512_END
+#endif
+
+    template <Op op, Mode mode>
+    std::size_t overflow_batch(std::span<const int> a, std::span<const int> b, std::span<int> out,
+                               std::span<std::uint64_t> overflow)
+    {
+      if (a.size() != b.size() || a.size() != out.size())
+      {
+        throw std::invalid_argument("Span sizes must match");
+      }
+
+      const std::size_t n = out.size();
+
+      if (mode == Mode::checked && overflow.size() < (n + 63) / 64)
+      {
+        throw std::invalid_argument("Overflow mask is too small");
+      }
+
+      MaskWriter mask{overflow.data()};
+
+#if CPP_CONCEPT_SIMD_X86
+      switch (simd::isa())
+      {
+      case simd::Isa::avx512:
+        overflow_avx512<op, mode>(a.data(), b.data(), out.data(), n, mask);
+        return mask.count;
+      case simd::Isa::avx2:
+        overflow_avx2<op, mode>(a.data(), b.data(), out.data(), n, mask);
+        return mask.count;
+      case simd::Isa::sse2:
+      case simd::Isa::scalar:
+        break;
+      }
+#endif
+
+      overflow_scalar<op, mode>(a.data(), b.data(), out.data(), 0, n, mask);
+      return mask.count;
+    }
+
+    // Inputs below this size are reduced on the calling thread only
+    constexpr std::size_t parallel_grain = std::size_t{1} << 16;
+
+    // Block length for argmax; 8 KiB stays in L1 while a block is searched again
+    constexpr std::size_t argmax_block = 2048;
+
+    int max_scalar(const int *values, std::size_t n)
+    {
+      return *std::max_element(values, values + n);
+    }
+
+#if CPP_CONCEPT_SIMD_X86
+    CPP_CONCEPT_TARGET("sse2")
+    __m128i max_epi32_sse2(__m128i a, __m128i b)
+    {
+      // SSE2 has no signed 32-bit max, so select through a compare mask
+      const __m128i greater = _mm_cmpgt_epi32(a, b);
+      return _mm_or_si128(_mm_and_si128(greater, a), _mm_andnot_si128(greater, b));
+    }
+
+    CPP_CONCEPT_TARGET("sse2")
+    int max_sse2(const int *values, std::size_t n)
+    {
+      __m128i acc0 = _mm_set1_epi32(values[0]);
+      __m128i acc1 = acc0;
+
+      std::size_t i = 0;
+      for (; i + 8 <= n; i += 8)
+      {
+        acc0 = max_epi32_sse2(acc0, _mm_loadu_si128(reinterpret_cast<const __m128i *>(values + i)));
+        acc1 = max_epi32_sse2(acc1, _mm_loadu_si128(reinterpret_cast<const __m128i *>(values + i + 4)));
+      }
+
+      __m128i acc = max_epi32_sse2(acc0, acc1);
+      acc = max_epi32_sse2(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(1, 0, 3, 2)));
+      acc = max_epi32_sse2(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(2, 3, 0, 1)));
+
+      const int best = _mm_cvtsi128_si32(acc);
+      return i < n ? std::max(best, max_scalar(values + i, n - i)) : best;
+    }
+
+    CPP_CONCEPT_TARGET("avx2")
+    int max_avx2(const int *values, std::size_t n)
+    {
+      // Four independent accumulators hide the latency of the max instruction
+      __m256i acc0 = _mm256_set1_epi32(values[0]);
+      __m256i acc1 = acc0;
+      __m256i acc2 = acc0;
+      __m256i acc3 = acc0;
+
+      std::size_t i = 0;
+      for (; i + 32 <= n; i += 32)
+      {
+        acc0 = _mm256_max_epi32(acc0, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values + i)));
+        acc1 = _mm256_max_epi32(acc1, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values + i + 8)));
+        acc2 = _mm256_max_epi32(acc2, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values + i + 16)));
+        acc3 = _mm256_max_epi32(acc3, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values + i + 24)));
+      }
+      for (; i + 8 <= n; i += 8)
+      {
+        acc0 = _mm256_max_epi32(acc0, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values + i)));
+      }
+
+      const __m256i acc = _mm256_max_epi32(_mm256_max_epi32(acc0, acc1), _mm256_max_epi32(acc2, acc3));
+      __m128i half = _mm_max_epi32(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+      half = _mm_max_epi32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(1, 0, 3, 2)));
+      half = _mm_max_epi32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(2, 3, 0, 1)));
+
+      const int best = _mm_cvtsi128_si32(half);
+      return i < n ? std::max(best, max_scalar(values + i, n - i)) : best;
+    }
+
+    CPP_CONCEPT_AVX512_BEGIN
+    CPP_CONCEPT_TARGET("avx512f")
+    int max_avx512(const int *values, std::size_t n)
+    {
+      __m512i acc0 = _mm512_set1_epi32(values[0]);
+      __m512i acc1 = acc0;
+
+      std::size_t i = 0;
+      for (; i + 32 <= n; i += 32)
+      {
+        acc0 = _mm512_max_epi32(acc0, _mm512_loadu_si512(values + i));
+        acc1 = _mm512_max_epi32(acc1, _mm512_loadu_si512(values + i + 16));
+      }
+      if (i < n)
+      {
+        // Masked loads cover the remaining lanes without a scalar tail
+        const auto remaining = static_cast<unsigned>(n - i);
+        const __mmask16 lo = remaining >= 16 ? __mmask16(0xFFFF) : static_cast<__mmask16>((1U << remaining) - 1);
+        const __mmask16 hi = remaining <= 16 ? __mmask16(0) : static_cast<__mmask16>((1U << (remaining - 16)) - 1);
+        acc0 = _mm512_mask_max_epi32(acc0, lo, acc0, _mm512_maskz_loadu_epi32(lo, values + i));
+        acc1 = _mm512_mask_max_epi32(acc1, hi, acc1, _mm512_maskz_loadu_epi32(hi, values + i + 16));
+      }
+
+      return _mm512_reduce_max_epi32(_mm512_max_epi32(acc0, acc1));
+    }
+    CPP_CONCEPT_AVX512_END
+#endif
+
+    // Reduces a non-empty range with the widest kernel the host supports
+    int reduce_max(const int *values, std::size_t n)
+    {
+#if CPP_CONCEPT_SIMD_X86
+      switch (simd::isa())
+      {
+      case simd::Isa::avx512:
+        return max_avx512(values, n);
+      case simd::Isa::avx2:
+        return max_avx2(values, n);
+      case simd::Isa::sse2:
+        return max_sse2(values, n);
+      case simd::Isa::scalar:
+        break;
+      }
+#endif
+
+      return max_scalar(values, n);
+    }
+
+    struct Maximum
+    {
+      int value;
+      std::size_t index;
+    };
+
+    // Single pass over a non-empty range: a block is searched for its position
+    // only when its maximum beats the running one, while it is still in L1
+    Maximum reduce_argmax(const int *values, std::size_t n)
+    {
+      Maximum best{values[0], 0};
+
+      for (std::size_t first = 0; first < n; first += argmax_block)
+      {
+        const std::size_t length = std::min(argmax_block, n - first);
+        const int value = reduce_max(values + first, length);
+
+        if (value > best.value || first == 0)
+        {
+          const int *position = std::find(values + first, values + first + length, value);
+          best = {value, static_cast<std::size_t>(position - values)};
+        }
+      }
+
+      return best;
+    }
+
+    struct BlockStats
+    {
+      int min;
+      int max;
+      std::int64_t sum;
+    };
+
+    BlockStats stats_scalar(const int *values, std::size_t n)
+    {
+      BlockStats stats{values[0], values[0], 0};
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        stats.min = std::min(stats.min, values[i]);
+        stats.max = std::max(stats.max, values[i]);
+        stats.sum += values[i];
+      }
+
+      return stats;
+    }
+
+    BlockStats merge_tail(BlockStats stats, const int *values, std::size_t first, std::size_t n)
+    {
+      if (first < n)
+      {
+        const BlockStats tail = stats_scalar(values + first, n - first);
+        stats.min = std::min(stats.min, tail.min);
+        stats.max = std::max(stats.max, tail.max);
+        stats.sum += tail.sum;
+      }
+
+      return stats;
+    }
+
+#if CPP_CONCEPT_SIMD_X86
+    CPP_CONCEPT_TARGET("sse2")
+    BlockStats stats_sse2(const int *values, std::size_t n)
+    {
+      __m128i lo = _mm_set1_epi32(values[0]);
+      __m128i hi = lo;
+      __m128i sum = _mm_setzero_si128();
+
+      std::size_t i = 0;
+      for (; i + 4 <= n; i += 4)
+      {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(values + i));
+        const __m128i less = _mm_cmplt_epi32(v, lo);
+        const __m128i greater = _mm_cmpgt_epi32(v, hi);
+        lo = _mm_or_si128(_mm_and_si128(less, v), _mm_andnot_si128(less, lo));
+        hi = _mm_or_si128(_mm_and_si128(greater, v), _mm_andnot_si128(greater, hi));
+
+        // Sign-extend to 64-bit lanes by interleaving with the sign mask
+        const __m128i sign = _mm_srai_epi32(v, 31);
+        sum = _mm_add_epi64(sum, _mm_unpacklo_epi32(v, sign));
+        sum = _mm_add_epi64(sum, _mm_unpackhi_epi32(v, sign));
+      }
+
+      alignas(16) int mins[4];
+      alignas(16) int maxs[4];
+      alignas(16) std::int64_t sums[2];
+      _mm_store_si128(reinterpret_cast<__m128i *>(mins), lo);
+      _mm_store_si128(reinterpret_cast<__m128i *>(maxs), hi);
+      _mm_store_si128(reinterpret_cast<__m128i *>(sums), sum);
+
+      BlockStats stats{*std::min_element(mins, mins + 4), *std::max_element(maxs, maxs + 4), sums[0] + sums[1]};
+      return merge_tail(stats, values, i, n);
+    }
+
+    CPP_CONCEPT_TARGET("avx2")
+    BlockStats stats_avx2(const int *values, std::size_t n)
+    {
+      __m256i lo = _mm256_set1_epi32(values[0]);
+      __m256i hi = lo;
+      __m256i sum0 = _mm256_setzero_si256();
+      __m256i sum1 = _mm256_setzero_si256();
+
+      std::size_t i = 0;
+      for (; i + 8 <= n; i += 8)
+      {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values + i));
+        lo = _mm256_min_epi32(lo, v);
+        hi = _mm256_max_epi32(hi, v);
+        sum0 = _mm256_add_epi64(sum0, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+        sum1 = _mm256_add_epi64(sum1, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+      }
+
+      __m128i lo128 = _mm_min_epi32(_mm256_castsi256_si128(lo), _mm256_extracti128_si256(lo, 1));
+      lo128 = _mm_min_epi32(lo128, _mm_shuffle_epi32(lo128, _MM_SHUFFLE(1, 0, 3, 2)));
+      lo128 = _mm_min_epi32(lo128, _mm_shuffle_epi32(lo128, _MM_SHUFFLE(2, 3, 0, 1)));
+
+      __m128i hi128 = _mm_max_epi32(_mm256_castsi256_si128(hi), _mm256_extracti128_si256(hi, 1));
+      hi128 = _mm_max_epi32(hi128, _mm_shuffle_epi32(hi128, _MM_SHUFFLE(1, 0, 3, 2)));
+      hi128 = _mm_max_epi32(hi128, _mm_shuffle_epi32(hi128, _MM_SHUFFLE(2, 3, 0, 1)));
+
+      const __m256i sum = _mm256_add_epi64(sum0, sum1);
+      const __m128i sum128 = _mm_add_epi64(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+      const std::int64_t total = _mm_cvtsi128_si64(sum128) + _mm_cvtsi128_si64(_mm_unpackhi_epi64(sum128, sum128));
+
+      BlockStats stats{_mm_cvtsi128_si32(lo128), _mm_cvtsi128_si32(hi128), total};
+      return merge_tail(stats, values, i, n);
+    }
+
+    CPP_CONCEPT_AVX512_BEGIN
+    CPP_CONCEPT_TARGET("avx512f")
+    BlockStats stats_avx512(const int *values, std::size_t n)
+    {
+      __m512i lo = _mm512_set1_epi32(values[0]);
+      __m512i hi = lo;
+      __m512i sum0 = _mm512_setzero_si512();
+      __m512i sum1 = _mm512_setzero_si512();
+
+      std::size_t i = 0;
+      for (; i + 16 <= n; i += 16)
+      {
+        const __m512i v = _mm512_loadu_si512(values + i);
+        lo = _mm512_min_epi32(lo, v);
+        hi = _mm512_max_epi32(hi, v);
+        sum0 = _mm512_add_epi64(sum0, _mm512_cvtepi32_epi64(_mm512_castsi512_si256(v)));
+        sum1 = _mm512_add_epi64(sum1, _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(v, 1)));
+      }
+
+      BlockStats stats{_mm512_reduce_min_epi32(lo), _mm512_reduce_max_epi32(hi),
+                       _mm512_reduce_add_epi64(_mm512_add_epi64(sum0, sum1))};
+      return merge_tail(stats, values, i, n);
+    }
+    CPP_CONCEPT_AVX512_END
+#endif
+
+    BlockStats reduce_stats(const int *values, std::size_t n)
+    {
+#if CPP_CONCEPT_SIMD_X86
+      switch (simd::isa())
+      {
+      case simd::Isa::avx512:
+        return stats_avx512(values, n);
+      case simd::Isa::avx2:
+        return stats_avx2(values, n);
+      case simd::Isa::sse2:
+        return stats_sse2(values, n);
+      case simd::Isa::scalar:
+        break;
+      }
+#endif
+
+      return stats_scalar(values, n);
+    }
+
+    // Same block scheme as reduce_argmax: positions are looked up only in blocks
+    // that improve the running extremes, while the block is still in L1
+    Summary reduce_summary(const int *values, std::size_t n)
+    {
+      Summary summary;
+      summary.count = n;
+
+      for (std::size_t first = 0; first < n; first += argmax_block)
+      {
+        const std::size_t length = std::min(argmax_block, n - first);
+        const int *block = values + first;
+        const BlockStats stats = reduce_stats(block, length);
+
+        if (stats.min < summary.min || first == 0)
+        {
+          summary.min = stats.min;
+          summary.argmin = static_cast<std::size_t>(std::find(block, block + length, stats.min) - values);
+        }
+        if (stats.max > summary.max || first == 0)
+        {
+          summary.max = stats.max;
+          summary.argmax = static_cast<std::size_t>(std::find(block, block + length, stats.max) - values);
+        }
+        summary.sum += stats.sum;
+      }
+
+      return summary;
+    }
+
+    // Lanes per threshold test; one bit per lane in the returned mask
+    constexpr std::size_t filter_block = 64;
+
+    // Bit i is set when values[i] > threshold, for the filter_block values at values
+    using FilterFn = std::uint64_t (*)(const int *values, int threshold);
+
+    std::uint64_t filter_scalar(const int *values, int threshold)
+    {
+      std::uint64_t mask = 0;
+      for (std::size_t i = 0; i < filter_block; ++i)
+      {
+        mask |= static_cast<std::uint64_t>(values[i] > threshold) << i;
+      }
+
+      return mask;
+    }
+
+#if CPP_CONCEPT_SIMD_X86
+    CPP_CONCEPT_TARGET("sse2")
+    std::uint64_t filter_sse2(const int *values, int threshold)
+    {
+      const __m128i t = _mm_set1_epi32(threshold);
+
+      std::uint64_t mask = 0;
+      for (std::size_t i = 0; i < filter_block; i += 4)
+      {
+        const __m128i above = _mm_cmpgt_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(values + i)), t);
+        mask |= static_cast<std::uint64_t>(_mm_movemask_ps(_mm_castsi128_ps(above))) << i;
+      }
+
+      return mask;
+    }
+
+    CPP_CONCEPT_TARGET("avx2")
+    std::uint64_t filter_avx2(const int *values, int threshold)
+    {
+      const __m256i t = _mm256_set1_epi32(threshold);
+
+      std::uint64_t mask = 0;
+      for (std::size_t i = 0; i < filter_block; i += 8)
+      {
+        const __m256i above = _mm256_cmpgt_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(values + i)), t);
+        mask |= static_cast<std::uint64_t>(_mm256_movemask_ps(_mm256_castsi256_ps(above))) << i;
+      }
+
+      return mask;
+    }
+
+    CPP_CONCEPT_TARGET("avx512f")
+    std::uint64_t filter_avx512(const int *values, int threshold)
+    {
+      const __m512i t = _mm512_set1_epi32(threshold);
+
+      std::uint64_t mask = 0;
+      for (std::size_t i = 0; i < filter_block; i += 16)
+      {
+        mask |= static_cast<std::uint64_t>(_mm512_cmpgt_epi32_mask(_mm512_loadu_si512(values + i), t)) << i;
+      }
+
+      return mask;
+    }
+#endif
+
+    FilterFn select_filter() noexcept
+    {
+#if CPP_CONCEPT_SIMD_X86
+      switch (simd::isa())
+      {
+      case simd::Isa::avx512:
+        return filter_avx512;
+      case simd::Isa::avx2:
+        return filter_avx2;
+      case simd::Isa::sse2:
+        return filter_sse2;
+      case simd::Isa::scalar:
+        break;
+      }
+#endif
+
+      return filter_scalar;
+    }
+
+    // Collects the min(k, n) largest values of a range into a min-heap under
+    // std::greater, so that heap.front() is the value a candidate must beat
+    std::vector<int> top_k_heap(const int *values, std::size_t n, std::size_t k)
+    {
+      k = std::min(k, n);
+      std::vector<int> heap(values, values + k);
+      if (k == 0)
+      {
+        return heap;
+      }
+
+      std::make_heap(heap.begin(), heap.end(), std::greater<>{});
+      auto offer = [&heap](int value)
+      {
+        // The threshold may have risen since the block was filtered
+        if (value > heap.front())
+        {
+          std::pop_heap(heap.begin(), heap.end(), std::greater<>{});
+          heap.back() = value;
+          std::push_heap(heap.begin(), heap.end(), std::greater<>{});
+        }
+      };
+
+      const FilterFn filter = select_filter();
+
+      std::size_t i = k;
+      for (; i + filter_block <= n; i += filter_block)
+      {
+        for (std::uint64_t mask = filter(values + i, heap.front()); mask != 0; mask &= mask - 1)
+        {
+          offer(values[i + static_cast<std::size_t>(std::countr_zero(mask))]);
+        }
+      }
+      for (; i < n; ++i)
+      {
+        offer(values[i]);
+      }
+
+      return heap;
+    }
+
+    // Trial divisors that reject most composites before Miller-Rabin
+    constexpr std::array<std::uint64_t, 18> small_primes = {2,  3,  5,  7,  11, 13, 17, 19, 23,
+                                                            29, 31, 37, 41, 43, 47, 53, 59, 61};
+
+    // Smallest prime missing from small_primes
+    constexpr std::uint64_t small_prime_bound = 67;
+
+    // Odd candidates at or above this survive trial division without being proven prime
+    constexpr std::uint32_t trial_bound = static_cast<std::uint32_t>(small_prime_bound * small_prime_bound);
+
+    // Bases that make Miller-Rabin exact below 4759123141, which covers every uint32_t
+    constexpr std::array<std::uint32_t, 3> bases_32 = {2, 7, 61};
+
+    bool prime_scalar(std::uint32_t n)
+    {
+      if (n < 2)
+      {
+        return false;
+      }
+
+      for (const auto p : small_primes)
+      {
+        if (n % p == 0)
+        {
+          return n == p;
+        }
+      }
+
+      if (n < trial_bound)
+      {
+        return true;
+      }
+
+      const int s = std::countr_zero(n - 1);
+      const std::uint64_t d = (n - 1) >> s;
+      for (const auto base : bases_32)
+      {
+        if (!modular::strong_probable_prime(n, base, d, s))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    // Bit i is set when values[i] is prime, for n <= 64 lanes
+    std::uint64_t primes_scalar(const std::uint32_t *values, std::size_t n)
+    {
+      std::uint64_t bits = 0;
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        bits |= static_cast<std::uint64_t>(prime_scalar(values[i])) << i;
+      }
+
+      return bits;
+    }
+
+#if CPP_CONCEPT_SIMD_X86
+    // An odd p divides n exactly when n * p^-1 mod 2^32 <= (2^32 - 1) / p
+    struct TrialDivisor
+    {
+      std::uint32_t p;
+      std::uint32_t inverse;
+      std::uint32_t limit;
+    };
+
+    constexpr auto trial_divisors = []
+    {
+      std::array<TrialDivisor, small_primes.size() - 1> divisors{};
+      for (std::size_t i = 1; i < small_primes.size(); ++i)
+      {
+        const auto p = static_cast<std::uint32_t>(small_primes[i]);
+        divisors[i - 1] = {p, modular::inverse_mod_2k(p), 0xFFFFFFFFU / p};
+      }
+
+      return divisors;
+    }();
+
+    CPP_CONCEPT_TARGET("avx2")
+    __m256i le_epu32_avx2(__m256i a, __m256i b)
+    {
+      return _mm256_cmpeq_epi32(_mm256_min_epu32(a, b), a);
+    }
+
+    CPP_CONCEPT_TARGET("avx2")
+    __m256i mulhi_epu32_avx2(__m256i a, __m256i b)
+    {
+      const __m256i even = _mm256_mul_epu32(a, b);
+      const __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+      return _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0xAA);
+    }
+
+    // Montgomery product a * b * 2^-32 mod n for a, b < n and n_inverse = n^-1 mod 2^32.
+    // The low halves of a * b and m * n agree by construction of m, so the
+    // reduction is a difference of high halves and never overflows 32 bits
+    CPP_CONCEPT_TARGET("avx2")
+    __m256i montgomery_avx2(__m256i a, __m256i b, __m256i n, __m256i n_inverse)
+    {
+      const __m256i m = _mm256_mullo_epi32(_mm256_mullo_epi32(a, b), n_inverse);
+      const __m256i hi = mulhi_epu32_avx2(a, b);
+      const __m256i mn = mulhi_epu32_avx2(m, n);
+      const __m256i borrow = _mm256_andnot_si256(_mm256_cmpeq_epi32(_mm256_max_epu32(hi, mn), hi), _mm256_set1_epi32(-1));
+      return _mm256_add_epi32(_mm256_sub_epi32(hi, mn), _mm256_and_si256(borrow, n));
+    }
+
+    // All-ones lanes are 0, 1 or a multiple of a table prime other than itself
+    CPP_CONCEPT_TARGET("avx2")
+    __m256i composite_avx2(__m256i n)
+    {
+      const __m256i even = _mm256_cmpeq_epi32(_mm256_and_si256(n, _mm256_set1_epi32(1)), _mm256_setzero_si256());
+      __m256i composite = _mm256_andnot_si256(_mm256_cmpeq_epi32(n, _mm256_set1_epi32(2)), even);
+      composite = _mm256_or_si256(composite, le_epu32_avx2(n, _mm256_set1_epi32(1)));
+
+      for (const auto &divisor : trial_divisors)
+      {
+        const __m256i product = _mm256_mullo_epi32(n, _mm256_set1_epi32(static_cast<int>(divisor.inverse)));
+        const __m256i divides = le_epu32_avx2(product, _mm256_set1_epi32(static_cast<int>(divisor.limit)));
+        const __m256i itself = _mm256_cmpeq_epi32(n, _mm256_set1_epi32(static_cast<int>(divisor.p)));
+        composite = _mm256_or_si256(composite, _mm256_andnot_si256(itself, divides));
+      }
+
+      return composite;
+    }
+
+    // Miller-Rabin on 8 odd lanes in [trial_bound, 2^32); bit i of the result is set when lane i is prime
+    CPP_CONCEPT_TARGET("avx2")
+    unsigned miller_rabin_avx2(const std::uint32_t *candidates)
+    {
+      // The per-lane split n - 1 = d * 2^s and R^2 mod n need a bit scan and a
+      // divide, which AVX2 lacks, so they are prepared in scalar code
+      alignas(32) std::uint32_t d[8];
+      alignas(32) std::uint32_t s[8];
+      alignas(32) std::uint32_t r2[8];
+      std::uint32_t any_d = 0;
+      int max_s = 0;
+      for (int lane = 0; lane < 8; ++lane)
+      {
+        const std::uint32_t n = candidates[lane];
+        const int shift = std::countr_zero(n - 1);
+        d[lane] = (n - 1) >> shift;
+        s[lane] = static_cast<std::uint32_t>(shift);
+        r2[lane] = static_cast<std::uint32_t>((0 - static_cast<std::uint64_t>(n)) % n);
+        any_d |= d[lane];
+        max_s = std::max(max_s, shift);
+      }
+
+      const __m256i n = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(candidates));
+      const __m256i vs = _mm256_load_si256(reinterpret_cast<const __m256i *>(s));
+      const __m256i vr2 = _mm256_load_si256(reinterpret_cast<const __m256i *>(r2));
+
+      __m256i n_inverse = n;
+      for (int step = 0; step < 4; ++step)
+      {
+        n_inverse = _mm256_mullo_epi32(n_inverse, _mm256_sub_epi32(_mm256_set1_epi32(2), _mm256_mullo_epi32(n, n_inverse)));
+      }
+
+      const __m256i one = montgomery_avx2(vr2, _mm256_set1_epi32(1), n, n_inverse);
+      const __m256i minus_one = _mm256_sub_epi32(n, one);
+
+      // Align the highest exponent bit of any lane with the sign bit for the left-to-right ladder
+      const int width = std::bit_width(any_d);
+      const __m256i d_top =
+          _mm256_sll_epi32(_mm256_load_si256(reinterpret_cast<const __m256i *>(d)), _mm_cvtsi32_si128(32 - width));
+
+      __m256i prime = _mm256_set1_epi32(-1);
+      for (const auto base : bases_32)
+      {
+        const __m256i a = montgomery_avx2(_mm256_set1_epi32(static_cast<int>(base)), vr2, n, n_inverse);
+
+        __m256i x = one;
+        __m256i bits = d_top;
+        for (int i = 0; i < width; ++i)
+        {
+          x = montgomery_avx2(x, x, n, n_inverse);
+          x = _mm256_blendv_epi8(x, montgomery_avx2(x, a, n, n_inverse), _mm256_srai_epi32(bits, 31));
+          bits = _mm256_slli_epi32(bits, 1);
+        }
+
+        __m256i pass = _mm256_or_si256(_mm256_cmpeq_epi32(x, one), _mm256_cmpeq_epi32(x, minus_one));
+        for (int r = 1; r < max_s; ++r)
+        {
+          x = montgomery_avx2(x, x, n, n_inverse);
+          const __m256i active = _mm256_cmpgt_epi32(vs, _mm256_set1_epi32(r));
+          pass = _mm256_or_si256(pass, _mm256_and_si256(active, _mm256_cmpeq_epi32(x, minus_one)));
+        }
+
+        prime = _mm256_and_si256(prime, pass);
+      }
+
+      return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(prime)));
+    }
+
+    // Trial division settles most lanes; the survivors are packed into groups
+    // of 8 so that every Miller-Rabin lane does useful work
+    CPP_CONCEPT_TARGET("avx2")
+    std::uint64_t primes_avx2(const std::uint32_t *values, std::size_t n)
+    {
+      std::uint64_t bits = 0;
+      std::uint64_t survivors = 0;
+
+      std::size_t i = 0;
+      for (; i + 8 <= n; i += 8)
+      {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values + i));
+        const __m256i candidate = _mm256_andnot_si256(composite_avx2(v), _mm256_set1_epi32(-1));
+        const __m256i small = le_epu32_avx2(v, _mm256_set1_epi32(static_cast<int>(trial_bound - 1)));
+
+        const auto known = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_and_si256(candidate, small))));
+        const auto open = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_andnot_si256(small, candidate))));
+        bits |= static_cast<std::uint64_t>(known) << i;
+        survivors |= static_cast<std::uint64_t>(open) << i;
+      }
+      if (i < n)
+      {
+        bits |= primes_scalar(values + i, n - i) << i;
+      }
+
+      std::uint32_t packed[8];
+      std::size_t lanes[8];
+      std::size_t count = 0;
+      while (survivors != 0)
+      {
+        const auto lane = static_cast<std::size_t>(std::countr_zero(survivors));
+        survivors &= survivors - 1;
+        packed[count] = values[lane];
+        lanes[count++] = lane;
+
+        if (count == 8 || survivors == 0)
+        {
+          // Pad a partial group with copies of its first candidate
+          std::fill(packed + count, packed + 8, packed[0]);
+          const unsigned prime = miller_rabin_avx2(packed);
+          for (std::size_t k = 0; k < count; ++k)
+          {
+            bits |= static_cast<std::uint64_t>((prime >> k) & 1U) << lanes[k];
+          }
+          count = 0;
+        }
+      }
+
+      return bits;
+    }
+#endif
+
+    std::size_t prime_batch(std::span<const std::uint32_t> values, std::span<std::uint64_t> mask)
+    {
+      const std::size_t n = values.size();
+      if (mask.size() < (n + 63) / 64)
+      {
+        throw std::invalid_argument("Prime mask is too small");
+      }
+
+      auto kernel = primes_scalar;
+#if CPP_CONCEPT_SIMD_X86
+      if (simd::isa() >= simd::Isa::avx2)
+      {
+        kernel = primes_avx2;
+      }
+#endif
+
+      std::size_t count = 0;
+      for (std::size_t first = 0; first < n; first += 64)
+      {
+        const std::uint64_t bits = kernel(values.data() + first, std::min<std::size_t>(64, n - first));
+        mask[first / 64] = bits;
+        count += static_cast<std::size_t>(std::popcount(bits));
+      }
+
+      return count;
+    }
+
+    // Adjacent segments sieved by one thread per round of for_each_prime
+    constexpr std::size_t segments_per_task = 8;
+
+    void check_sieve_range(std::uint64_t last)
+    {
+      if (last > sieve::limit)
+      {
+        throw std::invalid_argument("Range exceeds the sieve limit");
+      }
+    }
+
+    // The wheel skips 2, 3 and 5, so they are reported separately
+    std::vector<std::uint64_t> wheel_primes_in(std::uint64_t first, std::uint64_t last)
+    {
+      std::vector<std::uint64_t> primes;
+      for (const std::uint64_t p : {2, 3, 5})
+      {
+        if (first <= p && p < last)
+        {
+          primes.push_back(p);
+        }
+      }
+
+      return primes;
+    }
+
+    std::uint64_t segment_count(std::uint64_t first, std::uint64_t last)
+    {
+      const std::uint64_t aligned = first - first % 30;
+      return (last - aligned + sieve::segment_span - 1) / sieve::segment_span;
+    }
+
+    // Bounds of segments [a, b) of the range, clipped to [first, last)
+    std::pair<std::uint64_t, std::uint64_t> segment_bounds(std::uint64_t first, std::uint64_t last, std::uint64_t a,
+                                                           std::uint64_t b)
+    {
+      const std::uint64_t aligned = first - first % 30;
+      return {std::max(first, aligned + a * sieve::segment_span), std::min(last, aligned + b * sieve::segment_span)};
+    }
+
+    // Factorization trial-divides by the odd primes below this bound before Pollard's rho
+    constexpr std::uint64_t factor_trial_bound = 1024;
+
+    // An odd p divides n exactly when n * p^-1 mod 2^64 <= (2^64 - 1) / p,
+    // and the product is then the quotient n / p
+    struct FactorDivisor
+    {
+      std::uint64_t p;
+      std::uint64_t inverse;
+      std::uint64_t limit;
+    };
+
+    constexpr bool is_odd_prime(std::uint64_t p) noexcept
+    {
+      for (std::uint64_t q = 3; q * q <= p; q += 2)
+      {
+        if (p % q == 0)
+        {
+          return false;
+        }
+      }
+
+      return p > 2 && (p & 1) != 0;
+    }
+
+    // Number of odd primes below factor_trial_bound
+    constexpr std::size_t factor_divisor_count = []
+    {
+      std::size_t count = 0;
+      for (std::uint64_t p = 3; p < factor_trial_bound; p += 2)
+      {
+        count += is_odd_prime(p) ? 1 : 0;
+      }
+
+      return count;
+    }();
+
+    constexpr auto factor_divisors = []
+    {
+      std::array<FactorDivisor, factor_divisor_count> divisors{};
+      std::size_t count = 0;
+      for (std::uint64_t p = 3; p < factor_trial_bound; p += 2)
+      {
+        if (is_odd_prime(p))
+        {
+          divisors[count++] = {p, modular::inverse_mod_2k(p), ~std::uint64_t{0} / p};
+        }
+      }
+
+      return divisors;
+    }();
+
+    // Inputs per thread below which a factorization batch stays on one thread
+    constexpr std::size_t factor_grain = 64;
+
+    // Terms of |x - y| multiplied together between two gcd computations
+    constexpr std::uint64_t rho_batch = 128;
+
+    // Brent's variant of Pollard's rho for an odd composite n, iterating
+    // y -> y^2 + c in Montgomery form, which leaves every gcd with n unchanged.
+    // Returns a divisor of n, which is n itself when this c fails
+    std::uint64_t pollard_brent(const modular::Montgomery &mont, std::uint64_t c)
+    {
+      const std::uint64_t n = mont.modulus();
+      auto step = [&](std::uint64_t y)
+      {
+        const std::uint64_t square = mont.multiply(y, y);
+        const std::uint64_t sum = square + c;
+        return sum < square || sum >= n ? sum - n : sum;
+      };
+      auto distance = [](std::uint64_t a, std::uint64_t b) { return a > b ? a - b : b - a; };
+
+      std::uint64_t x = 0;
+      std::uint64_t y = 0;
+      std::uint64_t saved = 0;
+      std::uint64_t product = mont.to(1);
+      std::uint64_t divisor = 1;
+      for (std::uint64_t r = 1; divisor == 1; r <<= 1)
+      {
+        x = y;
+        for (std::uint64_t i = 0; i < r; ++i)
+        {
+          y = step(y);
+        }
+        for (std::uint64_t k = 0; k < r && divisor == 1; k += rho_batch)
+        {
+          saved = y;
+          for (std::uint64_t i = 0; i < std::min(rho_batch, r - k); ++i)
+          {
+            y = step(y);
+            product = mont.multiply(product, distance(x, y));
+          }
+          divisor = std::gcd(product, n);
+        }
+      }
+
+      // The batch product reached a multiple of n; replay the batch one term at a time
+      if (divisor == n)
+      {
+        do
+        {
+          saved = step(saved);
+          divisor = std::gcd(distance(x, saved), n);
+        } while (divisor == 1);
+      }
+
+      return divisor;
+    }
+
+    // Appends the prime factors of an odd n > 1 that has no prime factor below factor_trial_bound
+    void factor_odd(std::uint64_t n, std::vector<std::uint64_t> &factors)
+    {
+      if (n < factor_trial_bound * factor_trial_bound || modular::miller_rabin(n))
+      {
+        factors.push_back(n);
+        return;
+      }
+
+      const modular::Montgomery mont(n);
+      std::uint64_t divisor = n;
+      for (std::uint64_t c = 1; divisor == n; ++c)
+      {
+        divisor = pollard_brent(mont, c);
+      }
+      factor_odd(divisor, factors);
+      factor_odd(n / divisor, factors);
+    }
+
+    // Prime factors of n > 0 with multiplicity, in increasing order
+    std::vector<std::uint64_t> factorize_scalar(std::uint64_t n)
+    {
+      const int twos = std::countr_zero(n);
+      std::vector<std::uint64_t> factors(static_cast<std::size_t>(twos), 2);
+      n >>= twos;
+
+      for (const auto &divisor : factor_divisors)
+      {
+        // Any composite left would have a factor at most its square root
+        if (divisor.p * divisor.p > n)
+        {
+          break;
+        }
+        for (std::uint64_t quotient = n * divisor.inverse; quotient <= divisor.limit; quotient = n * divisor.inverse)
+        {
+          factors.push_back(divisor.p);
+          n = quotient;
+        }
+      }
+
+      if (n > 1)
+      {
+        factor_odd(n, factors);
+        std::sort(factors.begin(), factors.end());
+      }
+
+      return factors;
+    }
+
+    // Largest n whose Fibonacci number fits in 64 and 128 bits
+    constexpr int fibonacci_max_64 = 93;
+    constexpr int fibonacci_max_128 = 186;
+    constexpr int fibonacci_max_256 = 368;
+
+    // Distinct moduli whose Pisano period is cached; periods of further moduli
+    // are recomputed on every call
+    constexpr std::size_t pisano_cache_limit = 1024;
+
+    // F(n) and F(n + 1) modulo the odd modulus of mont by fast doubling in Montgomery form
+    std::pair<std::uint64_t, std::uint64_t> fibonacci_pair(const modular::Montgomery &mont, std::uint64_t n)
+    {
+      std::uint64_t a = 0;          // F(k)
+      std::uint64_t b = mont.to(1); // F(k + 1)
+      for (int bit = std::bit_width(n) - 1; bit >= 0; --bit)
+      {
+        const std::uint64_t even = mont.multiply(a, mont.subtract(mont.add(b, b), a));
+        const std::uint64_t odd = mont.add(mont.multiply(a, a), mont.multiply(b, b));
+
+        // The bits of n are random, so selecting without a branch avoids mispredictions
+        const bool set = (n >> bit) & 1U;
+        a = set ? odd : even;
+        b = set ? mont.add(even, odd) : odd;
+      }
+
+      return {mont.from(a), mont.from(b)};
+    }
+
+    // Product of a and b, or 0 if it does not fit in 64 bits
+    std::uint64_t product_or_zero(std::uint64_t a, std::uint64_t b) noexcept
+    {
+      const uint128_t product = static_cast<uint128_t>(a) * b;
+      return product >> 64 ? 0 : static_cast<std::uint64_t>(product);
+    }
+
+    // Pisano period of p^k for an odd prime p, or 0 if it does not fit in 64 bits
+    std::uint64_t pisano_prime_power(std::uint64_t p, int k, std::uint64_t power)
+    {
+      // pi(p) divides p - 1 if p = +-1 (mod 5), 2(p + 1) if p = +-2 (mod 5) and
+      // is 20 for p = 5, and pi(p^k) divides p^(k-1) pi(p)
+      const std::uint64_t residue = p % 5;
+      std::uint64_t period = 20;
+      if (residue == 1 || residue == 4)
+      {
+        period = p - 1;
+      }
+      else if (residue != 0)
+      {
+        period = product_or_zero(2, p + 1);
+      }
+      if (period == 0)
+      {
+        return 0;
+      }
+
+      std::vector<std::uint64_t> factors = factorize_scalar(period);
+      for (int i = 1; i < k; ++i)
+      {
+        period = product_or_zero(period, p);
+        factors.push_back(p);
+      }
+      if (period == 0)
+      {
+        return 0;
+      }
+
+      // The period is the least divisor L of that multiple with F(L) = 0 and F(L + 1) = 1
+      const modular::Montgomery mont(power);
+      factors.erase(std::unique(factors.begin(), factors.end()), factors.end());
+      for (const auto q : factors)
+      {
+        while (period % q == 0 && fibonacci_pair(mont, period / q) == std::pair<std::uint64_t, std::uint64_t>{0, 1})
+        {
+          period /= q;
+        }
+      }
+
+      return period;
+    }
+
+    // Pisano period of m > 1 as the lcm over its prime powers, or 0 if it does not fit in 64 bits
+    std::uint64_t pisano_period_uncached(std::uint64_t m)
+    {
+      const std::vector<std::uint64_t> factors = factorize_scalar(m);
+      std::uint64_t period = 1;
+      for (std::size_t i = 0; i < factors.size();)
+      {
+        const std::uint64_t p = factors[i];
+        std::uint64_t power = 1;
+        int k = 0;
+        for (; i < factors.size() && factors[i] == p; ++i, ++k)
+        {
+          power *= p;
+        }
+
+        const std::uint64_t part = p == 2 ? 3ULL << (k - 1) : pisano_prime_power(p, k, power);
+        if (part == 0)
+        {
+          return 0;
+        }
+        period = product_or_zero(period / std::gcd(period, part), part);
+        if (period == 0)
+        {
+          return 0;
+        }
+      }
+
+      return period;
+    }
+
+    // The period is found from the factorization of m, which is costly next to
+    // an evaluation, so it is kept per modulus. It is computed outside the lock
+    // so that a slow factorization does not stall callers using other moduli.
+    std::uint64_t pisano_period(std::uint64_t m)
+    {
+      static std::mutex mutex;
+      static std::unordered_map<std::uint64_t, std::uint64_t> periods;
+      {
+        const std::lock_guard lock(mutex);
+        if (const auto it = periods.find(m); it != periods.end())
+        {
+          return it->second;
+        }
+      }
+
+      const std::uint64_t period = pisano_period_uncached(m);
+      const std::lock_guard lock(mutex);
+      if (periods.size() < pisano_cache_limit)
+      {
+        periods.emplace(m, period);
+      }
+
+      return period;
+    }
+
+    // F(n) mod m for a fixed m > 1. The odd part of m runs in Montgomery form and
+    // the power-of-two part in wrapping arithmetic; the Chinese remainder theorem
+    // joins the two, so no step divides by m.
+    class FibonacciModulo
+    {
+    public:
+      explicit FibonacciModulo(std::uint64_t m)
+          : twos_(std::countr_zero(m)), mont_(m >> twos_), period_(pisano_period(m))
+      {
+      }
+
+      std::uint64_t operator()(std::uint64_t n) const
+      {
+        if (period_ != 0)
+        {
+          n %= period_;
+        }
+
+        const std::uint64_t odd = mont_.modulus();
+        if (twos_ == 0)
+        {
+          return fibonacci_pair(mont_, n).first;
+        }
+
+        const std::uint64_t mask = (std::uint64_t{1} << twos_) - 1;
+        const std::uint64_t low = fibonacci_doubling<std::uint64_t>(n) & mask;
+        if (odd == 1)
+        {
+          return low;
+        }
+
+        // x = high (mod odd) and x = low (mod 2^twos), with x < m
+        const std::uint64_t high = fibonacci_pair(mont_, n).first;
+        return high + odd * (((low - high) * mont_.inverse()) & mask);
+      }
+
+    private:
+      int twos_;
+      modular::Montgomery mont_;
+      std::uint64_t period_;
+    };
+
+    // Factor words below which a product is not worth splitting across threads
+    constexpr std::size_t factorial_grain = 2048;
+
+    // Limbs per thread below which a big multiplication is not worth splitting
+    constexpr std::size_t split_grain = 4096;
+
+    // Factor words multiplied one at a time at the leaves of the product tree
+    constexpr std::size_t product_leaf = 16;
+
+    // Odd prime power factors of the swing m! / (floor(m / 2)!)^2, packed into
+    // as few 64-bit words as they fit in. Every prime power of the swing is at
+    // most m, so primes up to sqrt(m) need their exponent worked out while the
+    // larger ones appear at most once.
+    std::vector<std::uint64_t> swing_factors(std::uint64_t m, std::span<const std::uint64_t> primes)
+    {
+      std::vector<std::uint64_t> words;
+      std::uint64_t word = 1;
+      const auto push = [&](std::uint64_t factor)
+      {
+        if (word > std::numeric_limits<std::uint64_t>::max() / factor)
+        {
+          words.push_back(word);
+          word = 1;
+        }
+        word *= factor;
+      };
+
+      const std::uint64_t root = modular::isqrt(m);
+      for (const auto p : primes)
+      {
+        if (p <= root)
+        {
+          // The exponent of p is the number of odd quotients floor(m / p^k)
+          std::uint64_t power = 1;
+          for (std::uint64_t q = m / p; q > 0; q /= p)
+          {
+            if (q & 1)
+            {
+              power *= p;
+            }
+          }
+          if (power > 1)
+          {
+            push(power);
+          }
+        }
+        else if ((m / p) & 1)
+        {
+          push(p);
+        }
+      }
+      if (word > 1)
+      {
+        words.push_back(word);
+      }
+
+      return words;
+    }
+
+    // Product of factors by balanced binary splitting, so both operands of
+    // every large multiplication have about the same size
+    BigInt product_tree(std::span<const std::uint64_t> factors)
+    {
+      if (factors.size() <= product_leaf)
+      {
+        BigInt product = 1U;
+        for (const auto factor : factors)
+        {
+          product *= factor;
+        }
+        return product;
+      }
+
+      const std::size_t half = factors.size() / 2;
+      return product_tree(factors.first(half)) * product_tree(factors.subspan(half));
+    }
+
+    // product_tree() with its subtrees spread over up to threads threads: each
+    // thread multiplies out one run of factors, then neighbouring runs are
+    // joined pairwise, one level at a time
+    BigInt product_tree(std::span<const std::uint64_t> factors, unsigned threads)
+    {
+      const std::size_t chunks = parallel::chunk_count(factors.size(), threads, factorial_grain);
+      std::vector<BigInt> partial(chunks);
+      parallel::for_each_chunk(factors.size(), chunks,
+                               [&](std::size_t chunk, std::size_t first, std::size_t last)
+                               { partial[chunk] = product_tree(factors.subspan(first, last - first)); });
+
+      while (partial.size() > 1)
+      {
+        const std::size_t pairs = partial.size() / 2;
+        std::vector<BigInt> joined(pairs + partial.size() % 2);
+        parallel::for_each_chunk(pairs, pairs,
+                                 [&](std::size_t, std::size_t first, std::size_t last)
+                                 {
+                                   for (std::size_t i = first; i < last; ++i)
+                                   {
+                                     joined[i] = partial[2 * i] * partial[2 * i + 1];
+                                   }
+                                 });
+        if (partial.size() % 2)
+        {
+          joined.back() = std::move(partial.back());
+        }
+        partial = std::move(joined);
+      }
+
+      return std::move(partial.front());
+    }
+
+    // Limbs [first, last) of x as a value of their own
+    BigInt slice(const BigInt &x, std::size_t first, std::size_t last)
+    {
+      return BigInt::from_limbs(x.limbs().subspan(first, last - first));
+    }
+
+    // a * b with a cut into runs of limbs, each at least as long as b and
+    // multiplied by b on a thread of its own
+    BigInt multiply_parallel(const BigInt &a, const BigInt &b, unsigned threads)
+    {
+      const std::size_t size = a.limbs().size();
+      const std::size_t chunks = parallel::chunk_count(size, threads, std::max(split_grain, b.limbs().size()));
+      if (chunks == 1)
+      {
+        return a * b;
+      }
+
+      std::vector<BigInt> partial(chunks);
+      parallel::for_each_chunk(size, chunks,
+                               [&](std::size_t chunk, std::size_t first, std::size_t last)
+                               { partial[chunk] = slice(a, first, last) * b; });
+
+      BigInt product;
+      for (std::size_t chunk = 0; chunk < chunks; ++chunk)
+      {
+        product += partial[chunk] << (64 * (size * chunk / chunks));
+      }
+
+      return product;
+    }
+
+    // a^2 from the three products of its halves, run on separate threads:
+    // (hi B + lo)^2 = hi^2 B^2 + 2 hi lo B + lo^2
+    BigInt square_parallel(const BigInt &a, unsigned threads)
+    {
+      const std::size_t size = a.limbs().size();
+      if (threads == 1 || size < 2 * split_grain)
+      {
+        return square(a);
+      }
+
+      const std::size_t half = size / 2;
+      const BigInt low = slice(a, 0, half);
+      const BigInt high = slice(a, half, size);
+      std::array<BigInt, 3> products;
+      parallel::for_each_chunk(products.size(), parallel::chunk_count(products.size(), threads, 1),
+                               [&](std::size_t, std::size_t first, std::size_t last)
+                               {
+                                 for (std::size_t i = first; i < last; ++i)
+                                 {
+                                   products[i] = i == 0 ? square(low) : i == 1 ? square(high) : low * high;
+                                 }
+                               });
+
+      return (products[1] << (128 * half)) + (products[2] << (64 * half + 1)) + products[0];
+    }
+
+  } // namespace
+
   int Foo::add(int a, int b) const
   {
-    return a + b;
+    return apply<Op::add>(a, b);
   }
 
   int Foo::subtract(int a, int b) const
   {
-    return a - b;
+    return apply<Op::subtract>(a, b);
   }
 
   int Foo::multiply(int a, int b) const
+  {
+    return apply<Op::multiply>(a, b);
+  }
+
+  void Foo::add(std::span<const int> a, std::span<const int> b, std::span<int> out) const
+  {
+    batch<Op::add>(a, b, out);
+  }
+
+  void Foo::subtract(std::span<const int> a, std::span<const int> b, std::span<int> out) const
+  {
+    batch<Op::subtract>(a, b, out);
+  }
+
+  void Foo::multiply(std::span<const int> a, std::span<const int> b, std::span<int> out) const
+  {
+    batch<Op::multiply>(a, b, out);
+  }
+
+  BigInt Foo::multiply(const BigInt &a, const BigInt &b) const
+  {
+    return a * b;
+  }
+
+  Int256 Foo::add(const Int256 &a, const Int256 &b) const
+  {
+    return a + b;
+  }
+
+  Int256 Foo::subtract(const Int256 &a, const Int256 &b) const
+  {
+    return a - b;
+  }
+
+  Int256 Foo::multiply(const Int256 &a, const Int256 &b) const
   {
     return a * b;
   }
 
+  bool Foo::checked_add(int a, int b, int &result) const
+  {
+    return checked<Op::add>(a, b, result);
+  }
+
+  std::size_t Foo::checked_add(std::span<const int> a, std::span<const int> b, std::span<int> out,
+                               std::span<std::uint64_t> overflow) const
+  {
+    return overflow_batch<Op::add, Mode::checked>(a, b, out, overflow);
+  }
+
+  int Foo::saturating_add(int a, int b) const
+  {
+    return saturating<Op::add>(a, b);
+  }
+
+  void Foo::saturating_add(std::span<const int> a, std::span<const int> b, std::span<int> out) const
+  {
+    overflow_batch<Op::add, Mode::saturating>(a, b, out, {});
+  }
+
+  bool Foo::checked_subtract(int a, int b, int &result) const
+  {
+    return checked<Op::subtract>(a, b, result);
+  }
+
+  std::size_t Foo::checked_subtract(std::span<const int> a, std::span<const int> b, std::span<int> out,
+                                    std::span<std::uint64_t> overflow) const
+  {
+    return overflow_batch<Op::subtract, Mode::checked>(a, b, out, overflow);
+  }
+
+  int Foo::saturating_subtract(int a, int b) const
+  {
+    return saturating<Op::subtract>(a, b);
+  }
+
+  void Foo::saturating_subtract(std::span<const int> a, std::span<const int> b, std::span<int> out) const
+  {
+    overflow_batch<Op::subtract, Mode::saturating>(a, b, out, {});
+  }
+
+  bool Foo::checked_multiply(int a, int b, int &result) const
+  {
+    return checked<Op::multiply>(a, b, result);
+  }
+
+  std::size_t Foo::checked_multiply(std::span<const int> a, std::span<const int> b, std::span<int> out,
+                                    std::span<std::uint64_t> overflow) const
+  {
+    return overflow_batch<Op::multiply, Mode::checked>(a, b, out, overflow);
+  }
+
+  int Foo::saturating_multiply(int a, int b) const
+  {
+    return saturating<Op::multiply>(a, b);
+  }
+
+  void Foo::saturating_multiply(std::span<const int> a, std::span<const int> b, std::span<int> out) const
+  {
+    overflow_batch<Op::multiply, Mode::saturating>(a, b, out, {});
+  }
+
   double Foo::divide(int numerator, int denominator) const
   {
     if (denominator == 0)
@@ -30,6 +1828,11 @@ namespace cpp_concept
     return static_cast<double>(numerator / denominator);
   }
 
+  void Foo::divide(std::span<const int> numerators, int denominator, std::span<double> out) const
+  {
+    Divider(denominator).divide(numerators, out);
+  }
+
   std::string Foo::greet(const std::string &text) const
   {
     return "Hello, " + text + "!";
@@ -45,20 +1848,30 @@ namespace cpp_concept
     return std::string(text.rbegin(), text.rend());
   }
 
-  unsigned long long Foo::factorial(int n) const
+  BigInt Foo::factorial_big(int n, unsigned threads) const
   {
     if (n < 0)
     {
       throw std::invalid_argument("Negative input not allowed");
     }
 
-    unsigned long long result = 1;
-    for (int i = 2; i <= n; ++i)
+    const auto m = static_cast<std::uint64_t>(n);
+    const unsigned workers = parallel::resolve(threads);
+    const std::vector<std::uint64_t> primes = primes_in(3, m + 1, workers);
+
+    // The odd part of k! is the odd part of floor(k / 2)! squared times the
+    // odd part of the swing of k, so it builds up from the top bits of n
+    BigInt odd = 1U;
+    for (int shift = std::bit_width(m) - 1; shift >= 0; --shift)
     {
-      result *= i;
+      const std::uint64_t k = m >> shift;
+      const auto count = static_cast<std::size_t>(std::upper_bound(primes.begin(), primes.end(), k) - primes.begin());
+      const std::vector<std::uint64_t> factors = swing_factors(k, std::span(primes).first(count));
+      odd = multiply_parallel(square_parallel(odd, workers), product_tree(factors, workers), workers);
     }
 
-    return result;
+    // n! has n - popcount(n) factors of two
+    return odd << (m - static_cast<std::uint64_t>(std::popcount(m)));
   }
 
   double Foo::spline(double x0, double y0, double x1, double y1, double x) const
@@ -72,69 +1885,462 @@ namespace cpp_concept
     return (1 - t) * y0 + t * y1; // Linear interpolation as a simple spline
   }
 
-  unsigned long long Foo::fibonacci(int n) const
+  Spline Foo::spline(std::span<const double> x, std::span<const double> y) const
+  {
+    return Spline(x, y);
+  }
+
+  uint128_t Foo::fibonacci128(int n) const
+  {
+    if (n < 0)
+    {
+      throw std::invalid_argument("Negative input not allowed");
+    }
+
+    return fibonacci_doubling<uint128_t>(static_cast<unsigned>(n));
+  }
+
+  Int256 Foo::fibonacci256(int n) const
   {
     if (n < 0)
     {
       throw std::invalid_argument("Negative input not allowed");
     }
 
+    return fibonacci_doubling<Int256>(static_cast<unsigned>(n));
+  }
+
+  BigInt Foo::fibonacci_big(int n) const
+  {
+    if (n < 0)
+    {
+      throw std::invalid_argument("Negative input not allowed");
+    }
     if (n == 0)
     {
-      return 0;
+      return {};
+    }
+
+    const auto bits = static_cast<unsigned>(n);
+    BigInt current = 1U; // F(k), starting from k = 1
+    BigInt previous;    // F(k - 1)
+    bool odd = true;    // Parity of k
+    for (int bit = std::bit_width(bits) - 2; bit >= 0; --bit)
+    {
+      const BigInt a = square(current);
+      BigInt b = square(previous);
+      BigInt next = (a << 2) - b; // F(2k + 1), before the +-2 correction
+      if (odd)
+      {
+        next -= 2U;
+      }
+      else
+      {
+        next += 2U;
+      }
+      b += a; // F(2k - 1)
+
+      BigInt even = next - b;
+      if ((bits >> bit) & 1U)
+      {
+        current = std::move(next);
+        previous = std::move(even);
+        odd = true;
+      }
+      else
+      {
+        current = std::move(even);
+        previous = std::move(b);
+        odd = false;
+      }
     }
 
-    if (n == 1)
+    return current;
+  }
+
+  std::uint64_t Foo::fibonacci_mod(std::uint64_t n, std::uint64_t m) const
+  {
+    if (m == 0)
     {
-      return 1;
+      throw std::invalid_argument("Modulus must be positive");
     }
+    if (m == 1)
+    {
+      return 0;
+    }
+
+    return FibonacciModulo(m)(n);
+  }
 
-    unsigned long long a = 0, b = 1, c;
-    for (int i = 2; i <= n; ++i)
+  void Foo::fibonacci_mod(std::span<const std::uint64_t> indices, std::uint64_t m, std::span<std::uint64_t> out) const
+  {
+    if (indices.size() != out.size())
+    {
+      throw std::invalid_argument("Span sizes must match");
+    }
+    if (m == 0)
     {
-      c = a + b;
-      a = b;
-      b = c;
+      throw std::invalid_argument("Modulus must be positive");
     }
+    if (m == 1)
+    {
+      std::fill(out.begin(), out.end(), 0);
+      return;
+    }
+
+    const FibonacciModulo fibonacci(m);
+    std::transform(indices.begin(), indices.end(), out.begin(), fibonacci);
+  }
 
-    return b;
+  bool Foo::checked_fibonacci(int n, unsigned long long &result) const
+  {
+    result = fibonacci(n);
+    return n > fibonacci_max_64;
+  }
+
+  bool Foo::checked_fibonacci(int n, uint128_t &result) const
+  {
+    result = fibonacci128(n);
+    return n > fibonacci_max_128;
   }
 
-  bool Foo::is_prime(int n) const
+  bool Foo::checked_fibonacci(int n, Int256 &result) const
   {
-    if (n <= 1)
+    result = fibonacci256(n);
+    return n > fibonacci_max_256;
+  }
+
+  bool Foo::is_prime(std::uint64_t n) const
+  {
+    if (n < 2)
     {
       return false;
     }
 
-    for (int i = 2; i * i <= n; ++i)
+    for (const auto p : small_primes)
     {
-      if (n % i == 0)
+      if (n % p == 0)
       {
-        return false;
+        return n == p;
       }
     }
 
-    return true;
+    // Every composite below the square of the next prime has a factor in the table
+    if (n < small_prime_bound * small_prime_bound)
+    {
+      return true;
+    }
+
+    return modular::miller_rabin(n);
+  }
+
+  std::size_t Foo::is_prime(std::span<const std::uint32_t> values, std::span<std::uint64_t> mask) const
+  {
+    return prime_batch(values, mask);
+  }
+
+  void Foo::for_each_prime(std::uint64_t first, std::uint64_t last,
+                           const std::function<void(std::span<const std::uint64_t>)> &callback, unsigned threads) const
+  {
+    check_sieve_range(last);
+    if (first >= last)
+    {
+      return;
+    }
+
+    if (const auto small = wheel_primes_in(first, last); !small.empty())
+    {
+      callback(small);
+    }
+
+    const std::vector<std::uint32_t> primes = sieve::base_primes(last);
+    const std::uint64_t segments = segment_count(first, last);
+    const std::uint64_t round = parallel::resolve(threads) * segments_per_task;
+    const std::size_t chunks = parallel::chunk_count(std::min(round, segments), threads, segments_per_task);
+
+    // Each round sieves one run of adjacent segments per thread into one of
+    // two slots, and the runs of a round are delivered in order while the
+    // next round is sieved into the other slot
+    std::array<std::vector<std::vector<std::uint64_t>>, 2> runs;
+    runs.fill(std::vector<std::vector<std::uint64_t>>(chunks));
+    parallel::for_each_round(
+        segments, round, chunks,
+        [&](std::size_t slot, std::size_t chunk, std::size_t a, std::size_t b)
+        {
+          auto &run = runs[slot][chunk];
+          run.clear();
+          if (a == b)
+          {
+            return;
+          }
+
+          const auto [lo, hi] = segment_bounds(first, last, a, b);
+          sieve::Segments sieve(primes, lo, hi);
+          while (sieve.next())
+          {
+            sieve.collect(run);
+          }
+        },
+        [&](std::size_t slot)
+        {
+          for (const auto &run : runs[slot])
+          {
+            if (!run.empty())
+            {
+              callback(run);
+            }
+          }
+        });
+  }
+
+  std::vector<std::uint64_t> Foo::primes_in(std::uint64_t first, std::uint64_t last, unsigned threads) const
+  {
+    std::vector<std::uint64_t> primes;
+    for_each_prime(first, last, [&primes](std::span<const std::uint64_t> run)
+                   { primes.insert(primes.end(), run.begin(), run.end()); }, threads);
+
+    return primes;
+  }
+
+  std::uint64_t Foo::count_primes(std::uint64_t first, std::uint64_t last, unsigned threads) const
+  {
+    check_sieve_range(last);
+    if (first >= last)
+    {
+      return 0;
+    }
+
+    const std::vector<std::uint32_t> primes = sieve::base_primes(last);
+    const std::uint64_t segments = segment_count(first, last);
+    const std::size_t chunks = parallel::chunk_count(segments, threads, segments_per_task);
+    std::vector<std::uint64_t> partial(chunks);
+    parallel::for_each_chunk(segments, chunks,
+                             [&](std::size_t chunk, std::size_t a, std::size_t b)
+                             {
+                               const auto [lo, hi] = segment_bounds(first, last, a, b);
+                               sieve::Segments sieve(primes, lo, hi);
+                               while (sieve.next())
+                               {
+                                 partial[chunk] += sieve.count();
+                               }
+                             });
+
+    std::uint64_t count = wheel_primes_in(first, last).size();
+    for (const auto part : partial)
+    {
+      count += part;
+    }
+
+    return count;
+  }
+
+  std::uint64_t Foo::prime_pi(std::uint64_t x, unsigned threads) const
+  {
+    check_sieve_range(x);
+
+    return sieve::prime_pi(x, threads);
+  }
+
+  std::vector<std::uint64_t> Foo::factorize(std::uint64_t n) const
+  {
+    if (n == 0)
+    {
+      throw std::invalid_argument("Cannot factorize zero");
+    }
+
+    return factorize_scalar(n);
+  }
+
+  std::vector<std::vector<std::uint64_t>> Foo::factorize(std::span<const std::uint64_t> values, unsigned threads) const
+  {
+    if (std::find(values.begin(), values.end(), std::uint64_t{0}) != values.end())
+    {
+      throw std::invalid_argument("Cannot factorize zero");
+    }
+
+    std::vector<std::vector<std::uint64_t>> factors(values.size());
+    const std::size_t chunks = parallel::chunk_count(values.size(), threads, factor_grain);
+    parallel::for_each_chunk(values.size(), chunks,
+                             [&](std::size_t, std::size_t first, std::size_t last)
+                             {
+                               for (std::size_t i = first; i < last; ++i)
+                               {
+                                 factors[i] = factorize_scalar(values[i]);
+                               }
+                             });
+
+    return factors;
   }
 
   int Foo::find_max(const std::vector<int> &vec) const
   {
-    if (vec.empty())
+    return find_max(std::span<const int>(vec));
+  }
+
+  int Foo::find_max(std::span<const int> values) const
+  {
+    if (values.empty())
+    {
+      throw std::invalid_argument("Vector cannot be empty");
+    }
+
+    return reduce_max(values.data(), values.size());
+  }
+
+  int Foo::find_max_parallel(std::span<const int> values, unsigned threads) const
+  {
+    if (values.empty())
+    {
+      throw std::invalid_argument("Vector cannot be empty");
+    }
+
+    const std::size_t chunks = parallel::chunk_count(values.size(), threads, parallel_grain);
+    std::vector<int> partial(chunks);
+    parallel::for_each_chunk(values.size(), chunks,
+                             [&](std::size_t chunk, std::size_t first, std::size_t last)
+                             { partial[chunk] = reduce_max(values.data() + first, last - first); });
+
+    return *std::max_element(partial.begin(), partial.end());
+  }
+
+  std::size_t Foo::argmax(std::span<const int> values) const
+  {
+    if (values.empty())
+    {
+      throw std::invalid_argument("Vector cannot be empty");
+    }
+
+    return reduce_argmax(values.data(), values.size()).index;
+  }
+
+  std::size_t Foo::argmax_parallel(std::span<const int> values, unsigned threads) const
+  {
+    if (values.empty())
     {
       throw std::invalid_argument("Vector cannot be empty");
     }
 
-    int max_val = vec[0];
-    for (size_t i = 1; i < vec.size(); ++i)
+    const std::size_t chunks = parallel::chunk_count(values.size(), threads, parallel_grain);
+    std::vector<Maximum> partial(chunks);
+    parallel::for_each_chunk(values.size(), chunks,
+                             [&](std::size_t chunk, std::size_t first, std::size_t last)
+                             {
+                               partial[chunk] = reduce_argmax(values.data() + first, last - first);
+                               partial[chunk].index += first;
+                             });
+
+    // Chunks are ordered, so keeping the earlier chunk on ties yields the first maximum
+    Maximum best = partial[0];
+    for (const auto &candidate : partial)
     {
-      if (vec[i] > max_val)
+      if (candidate.value > best.value)
       {
-        max_val = vec[i];
+        best = candidate;
       }
     }
 
-    return max_val;
+    return best.index;
+  }
+
+  std::vector<int> Foo::find_top_k(std::span<const int> values, std::size_t k) const
+  {
+    std::vector<int> top = top_k_heap(values.data(), values.size(), k);
+    std::sort_heap(top.begin(), top.end(), std::greater<>{});
+
+    return top;
+  }
+
+  std::vector<int> Foo::find_top_k_parallel(std::span<const int> values, std::size_t k, unsigned threads) const
+  {
+    const std::size_t chunks = parallel::chunk_count(values.size(), threads, parallel_grain);
+    std::vector<std::vector<int>> partial(chunks);
+    parallel::for_each_chunk(values.size(), chunks,
+                             [&](std::size_t chunk, std::size_t first, std::size_t last)
+                             { partial[chunk] = top_k_heap(values.data() + first, last - first, k); });
+
+    // Each chunk keeps at most k of its own values, so the candidates never
+    // outnumber the input, however k compares to the chunk sizes
+    std::size_t total = 0;
+    for (const auto &part : partial)
+    {
+      total += part.size();
+    }
+
+    std::vector<int> candidates;
+    candidates.reserve(total);
+    for (const auto &part : partial)
+    {
+      candidates.insert(candidates.end(), part.begin(), part.end());
+    }
+
+    // At most chunks * k candidates remain, so a partial sort of them is cheap
+    k = std::min(k, candidates.size());
+    std::partial_sort(candidates.begin(), candidates.begin() + static_cast<std::ptrdiff_t>(k), candidates.end(),
+                      std::greater<>{});
+    candidates.resize(k);
+
+    return candidates;
+  }
+
+  double Summary::mean() const noexcept
+  {
+    return count == 0 ? 0.0 : static_cast<double>(sum) / static_cast<double>(count);
+  }
+
+  void Summary::merge(const Summary &other) noexcept
+  {
+    if (other.count == 0)
+    {
+      return;
+    }
+
+    if (count == 0)
+    {
+      *this = other;
+      return;
+    }
+
+    if (other.min < min || (other.min == min && other.argmin < argmin))
+    {
+      min = other.min;
+      argmin = other.argmin;
+    }
+    if (other.max > max || (other.max == max && other.argmax < argmax))
+    {
+      max = other.max;
+      argmax = other.argmax;
+    }
+    sum += other.sum;
+    count += other.count;
+  }
+
+  Summary Foo::summarize(std::span<const int> values, std::size_t offset) const
+  {
+    Summary summary = reduce_summary(values.data(), values.size());
+    if (summary.count != 0)
+    {
+      summary.argmin += offset;
+      summary.argmax += offset;
+    }
+
+    return summary;
+  }
+
+  Summary Foo::summarize_parallel(std::span<const int> values, unsigned threads) const
+  {
+    const std::size_t chunks = parallel::chunk_count(values.size(), threads, parallel_grain);
+    std::vector<Summary> partial(chunks);
+    parallel::for_each_chunk(values.size(), chunks,
+                             [&](std::size_t chunk, std::size_t first, std::size_t last)
+                             { partial[chunk] = summarize(values.subspan(first, last - first), first); });
+
+    Summary summary;
+    for (const auto &part : partial)
+    {
+      summary.merge(part);
+    }
+
+    return summary;
   }
 
 } // namespace cpp_concept
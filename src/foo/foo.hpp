@@ -1,5 +1,19 @@
 #pragma once
 
+#include "foo/big_int.hpp"
+#include "foo/fibonacci.hpp"
+#include "foo/fixed_int.hpp"
+#include "foo/spline.hpp"
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <span>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -25,6 +39,76 @@
 namespace cpp_concept
 {
 
+  /**
+   * @brief Single-pass statistics of an integer sequence.
+   *
+   * Produced by Foo::summarize(). Summaries of adjacent or disjoint chunks can
+   * be combined with merge(), so a large input may be summarized per chunk in
+   * parallel and reduced afterwards. A default-constructed Summary describes
+   * the empty sequence and is the identity of merge().
+   *
+   * @note The sum is widened to 64 bits and is exact for up to \f$2^{32}\f$ elements.
+   *
+   * @see Foo::summarize()
+   *
+   * @since 1.1
+   */
+  struct Summary
+  {
+    int min = std::numeric_limits<int>::max(); ///< Smallest element.
+    int max = std::numeric_limits<int>::min(); ///< Largest element.
+    std::size_t argmin = 0;                    ///< Index of the first smallest element.
+    std::size_t argmax = 0;                    ///< Index of the first largest element.
+    std::int64_t sum = 0;                      ///< Sum of all elements.
+    std::size_t count = 0;                     ///< Number of elements.
+
+    /**
+     * @brief Returns the arithmetic mean of the summarized elements.
+     *
+     * @return \f$sum / count\f$, or 0.0 for an empty summary.
+     */
+    double mean() const noexcept;
+
+    /**
+     * @brief Folds another summary into this one.
+     *
+     * Both summaries must index the same underlying sequence. When both hold
+     * the same extreme value, the smaller index wins, so the result does not
+     * depend on the order in which partial summaries are merged.
+     *
+     * @param[in] other The summary to combine with this one.
+     */
+    void merge(const Summary &other) noexcept;
+  };
+
+  /**
+   * @brief Operands of the unsigned 128-bit Foo arithmetic.
+   *
+   * At least one operand is a uint128_t and the other is a uint128_t or a
+   * NumericIntegral, so bool and character operands are rejected. Operands
+   * without a uint128_t keep resolving to the int overloads, so adding these
+   * overloads changes no existing call.
+   *
+   * @see Foo::add(A, B)
+   *
+   * @since 1.1
+   */
+  template <typename A, typename B>
+  concept Uint128Operands = (std::same_as<A, uint128_t> || std::same_as<B, uint128_t>) &&
+                            (std::same_as<A, uint128_t> || NumericIntegral<A>) &&
+                            (std::same_as<B, uint128_t> || NumericIntegral<B>);
+
+  /**
+   * @brief Operands of the Foo arithmetic of which at least one is bool or a character type.
+   *
+   * Such calls are deleted rather than left to promote silently to int or
+   * convert to a wider type.
+   *
+   * @see NumericIntegral
+   */
+  template <typename A, typename B>
+  concept NonNumericOperands = (std::integral<A> && !NumericIntegral<A>) || (std::integral<B> && !NumericIntegral<B>);
+
   /**
    * @brief A utility class providing basic mathematical and string operations.
    *
@@ -63,8 +147,10 @@ namespace cpp_concept
      *
      * @return The sum of a and b.
      *
-     * @note Integer overflow is undefined behavior for signed integers.
+     * @note Overflow wraps modulo \f$2^{32}\f$, so INT_MAX + 1 yields INT_MIN.
      *
+     * @see checked_add()
+     * @see saturating_add()
      * @see subtract()
      * @see multiply()
      */
@@ -78,8 +164,10 @@ namespace cpp_concept
      *
      * @return The difference \f$(a - b)\f$.
      *
-     * @note Integer overflow is undefined behavior for signed integers.
+     * @note Overflow wraps modulo \f$2^{32}\f$.
      *
+     * @see checked_subtract()
+     * @see saturating_subtract()
      * @see add()
      */
     int subtract(int a, int b) const;
@@ -92,12 +180,428 @@ namespace cpp_concept
      *
      * @return The product \f$(a \times b)\f$.
      *
-     * @note Integer overflow is undefined behavior for signed integers.
+     * @note Overflow keeps the low 32 bits of the product.
      *
+     * @see checked_multiply()
+     * @see saturating_multiply()
+     * @see multiply(const BigInt &, const BigInt &)
      * @see divide()
      */
     int multiply(int a, int b) const;
 
+    /**
+     * @brief Adds two integer spans element-wise.
+     *
+     * Computes \f$out_i = a_i + b_i\f$ for every lane using the widest SIMD
+     * kernel available on the host (AVX-512, AVX2 or SSE2), with a scalar
+     * fallback on other architectures.
+     *
+     * @param[in] a The first operand span.
+     * @param[in] b The second operand span.
+     * @param[out] out The destination span.
+     *
+     * @throws std::invalid_argument If the spans differ in size.
+     *
+     * @pre a.size() == b.size() == out.size()
+     *
+     * @note Overflow wraps modulo \f$2^{32}\f$, so INT_MAX + 1 yields INT_MIN.
+     * @note out may alias a or b exactly, but must not partially overlap them.
+     *
+     * @see add(int, int)
+     */
+    void add(std::span<const int> a, std::span<const int> b, std::span<int> out) const;
+
+    /**
+     * @brief Subtracts two integer spans element-wise.
+     *
+     * Computes \f$out_i = a_i - b_i\f$ for every lane.
+     *
+     * @param[in] a The minuend span.
+     * @param[in] b The subtrahend span.
+     * @param[out] out The destination span.
+     *
+     * @throws std::invalid_argument If the spans differ in size.
+     *
+     * @pre a.size() == b.size() == out.size()
+     *
+     * @note Overflow wraps modulo \f$2^{32}\f$.
+     * @note out may alias a or b exactly, but must not partially overlap them.
+     *
+     * @see subtract(int, int)
+     */
+    void subtract(std::span<const int> a, std::span<const int> b, std::span<int> out) const;
+
+    /**
+     * @brief Multiplies two integer spans element-wise.
+     *
+     * Computes \f$out_i = a_i \times b_i\f$ for every lane.
+     *
+     * @param[in] a The first operand span.
+     * @param[in] b The second operand span.
+     * @param[out] out The destination span.
+     *
+     * @throws std::invalid_argument If the spans differ in size.
+     *
+     * @pre a.size() == b.size() == out.size()
+     *
+     * @note Overflow keeps the low 32 bits of the product.
+     * @note out may alias a or b exactly, but must not partially overlap them.
+     *
+     * @see multiply(int, int)
+     * @see ModContext
+     */
+    void multiply(std::span<const int> a, std::span<const int> b, std::span<int> out) const;
+
+    /**
+     * @brief Multiplies two arbitrary-precision integers exactly.
+     *
+     * Picks schoolbook, Karatsuba, Toom-3 or NTT multiplication by the
+     * length of the shorter operand, with a squaring path when a and b are
+     * the same object.
+     *
+     * @param[in] a The first factor.
+     * @param[in] b The second factor.
+     *
+     * @return The product \f$a \cdot b\f$, without overflow.
+     *
+     * @see multiply(int, int)
+     * @see BigInt::Multiplication
+     */
+    BigInt multiply(const BigInt &a, const BigInt &b) const;
+
+    /**
+     * @brief Adds two 256-bit integers.
+     *
+     * @param[in] a The first integer to add.
+     * @param[in] b The second integer to add.
+     *
+     * @return The sum \f$(a + b)\f$.
+     *
+     * @note Overflow wraps modulo \f$2^{256}\f$, so it needs operands beyond
+     *       \f$\pm 2^{254}\f$, far past any sum of int or 64-bit values.
+     *
+     * @see add(int, int)
+     */
+    Int256 add(const Int256 &a, const Int256 &b) const;
+
+    /**
+     * @brief Adds two unsigned 128-bit integers.
+     *
+     * A built-in integer operand is converted to uint128_t first, so
+     * add(x, 1) with a uint128_t x is 128-bit arithmetic instead of an int
+     * sum of a narrowed x.
+     *
+     * @tparam A The type of a, see Uint128Operands.
+     * @tparam B The type of b, see Uint128Operands.
+     * @param[in] a The first integer to add.
+     * @param[in] b The second integer to add.
+     *
+     * @return The sum \f$(a + b) \bmod 2^{128}\f$.
+     *
+     * @note Overflow wraps modulo \f$2^{128}\f$; use the Int256 overload for exact sums.
+     *
+     * @see add(const Int256 &, const Int256 &)
+     */
+    template <typename A, typename B>
+      requires Uint128Operands<A, B>
+    uint128_t add(A a, B b) const
+    {
+      return static_cast<uint128_t>(a) + static_cast<uint128_t>(b);
+    }
+
+    /**
+     * @brief Rejects bool and character operands instead of promoting them to int.
+     *
+     * @see NonNumericOperands
+     */
+    template <typename A, typename B>
+      requires NonNumericOperands<A, B>
+    void add(A a, B b) const = delete;
+
+    /**
+     * @brief Subtracts the second 256-bit integer from the first.
+     *
+     * @param[in] a The minuend.
+     * @param[in] b The subtrahend.
+     *
+     * @return The difference \f$(a - b)\f$.
+     *
+     * @note Overflow wraps modulo \f$2^{256}\f$.
+     *
+     * @see subtract(int, int)
+     */
+    Int256 subtract(const Int256 &a, const Int256 &b) const;
+
+    /**
+     * @brief Subtracts the second unsigned 128-bit integer from the first.
+     *
+     * @tparam A The type of a, see Uint128Operands.
+     * @tparam B The type of b, see Uint128Operands.
+     * @param[in] a The minuend.
+     * @param[in] b The subtrahend.
+     *
+     * @return The difference \f$(a - b) \bmod 2^{128}\f$.
+     *
+     * @note Overflow wraps modulo \f$2^{128}\f$.
+     *
+     * @see subtract(const Int256 &, const Int256 &)
+     */
+    template <typename A, typename B>
+      requires Uint128Operands<A, B>
+    uint128_t subtract(A a, B b) const
+    {
+      return static_cast<uint128_t>(a) - static_cast<uint128_t>(b);
+    }
+
+    /**
+     * @brief Rejects bool and character operands instead of promoting them to int.
+     *
+     * @see NonNumericOperands
+     */
+    template <typename A, typename B>
+      requires NonNumericOperands<A, B>
+    void subtract(A a, B b) const = delete;
+
+    /**
+     * @brief Multiplies two 256-bit integers.
+     *
+     * Exact whenever the product fits in 255 bits plus sign, for example for
+     * any two 64-bit factors or two factors of magnitude below \f$2^{127}\f$.
+     * Two full 128-bit factors can need all 256 bits, which the sign bit
+     * cannot spare.
+     *
+     * @param[in] a The first integer to multiply.
+     * @param[in] b The second integer to multiply.
+     *
+     * @return The product \f$(a \times b)\f$.
+     *
+     * @note Overflow keeps the low 256 bits of the product.
+     *
+     * @see multiply(int, int)
+     * @see multiply(const BigInt &, const BigInt &)
+     */
+    Int256 multiply(const Int256 &a, const Int256 &b) const;
+
+    /**
+     * @brief Multiplies two unsigned 128-bit integers.
+     *
+     * @tparam A The type of a, see Uint128Operands.
+     * @tparam B The type of b, see Uint128Operands.
+     * @param[in] a The first integer to multiply.
+     * @param[in] b The second integer to multiply.
+     *
+     * @return The product \f$(a \times b) \bmod 2^{128}\f$.
+     *
+     * @note Overflow keeps the low 128 bits of the product; the Int256
+     *       overload is exact while both factors stay below \f$2^{127}\f$.
+     *
+     * @see multiply(const Int256 &, const Int256 &)
+     */
+    template <typename A, typename B>
+      requires Uint128Operands<A, B>
+    uint128_t multiply(A a, B b) const
+    {
+      return static_cast<uint128_t>(a) * static_cast<uint128_t>(b);
+    }
+
+    /**
+     * @brief Rejects bool and character operands instead of promoting them to int.
+     *
+     * @see NonNumericOperands
+     */
+    template <typename A, typename B>
+      requires NonNumericOperands<A, B>
+    void multiply(A a, B b) const = delete;
+
+    /**
+     * @brief Adds two integers and reports whether the result overflowed.
+     *
+     * @param[in] a The first operand.
+     * @param[in] b The second operand.
+     * @param[out] result The wrapped sum, identical to add(a, b).
+     *
+     * @retval true  If the exact sum \f$a + b\f$ does not fit in an int.
+     * @retval false If result holds the exact sum.
+     *
+     * @see saturating_add()
+     */
+    bool checked_add(int a, int b, int &result) const;
+
+    /**
+     * @brief Adds two integer spans element-wise and records overflowing lanes.
+     *
+     * Writes the wrapped sum of every lane to out and sets bit \f$i \bmod 64\f$
+     * of word \f$\lfloor i / 64 \rfloor\f$ in overflow when lane i overflowed.
+     * Overflow detection is folded into the SIMD kernel, so no per-lane branch
+     * is taken.
+     *
+     * @param[in] a The first operand span.
+     * @param[in] b The second operand span.
+     * @param[out] out The destination span.
+     * @param[out] overflow The per-lane overflow bitmask, one bit per lane.
+     *
+     * @return The number of lanes that overflowed.
+     *
+     * @throws std::invalid_argument If the spans differ in size or overflow
+     *         holds fewer than \f$\lceil n / 64 \rceil\f$ words.
+     *
+     * @pre a.size() == b.size() == out.size()
+     * @post Bits past the last lane in the final overflow word are zero.
+     */
+    std::size_t checked_add(std::span<const int> a, std::span<const int> b, std::span<int> out,
+                            std::span<std::uint64_t> overflow) const;
+
+    /**
+     * @brief Adds two integers, clamping the result to the int range.
+     *
+     * @param[in] a The first operand.
+     * @param[in] b The second operand.
+     *
+     * @return The sum \f$a + b\f$ clamped to [INT_MIN, INT_MAX].
+     *
+     * @see checked_add()
+     */
+    int saturating_add(int a, int b) const;
+
+    /**
+     * @brief Adds two integer spans element-wise with saturation.
+     *
+     * @param[in] a The first operand span.
+     * @param[in] b The second operand span.
+     * @param[out] out The destination span receiving the clamped sums.
+     *
+     * @throws std::invalid_argument If the spans differ in size.
+     *
+     * @pre a.size() == b.size() == out.size()
+     */
+    void saturating_add(std::span<const int> a, std::span<const int> b, std::span<int> out) const;
+
+    /**
+     * @brief Subtracts two integers and reports whether the result overflowed.
+     *
+     * @param[in] a The first operand.
+     * @param[in] b The second operand.
+     * @param[out] result The wrapped difference, identical to subtract(a, b).
+     *
+     * @retval true  If the exact difference \f$a - b\f$ does not fit in an int.
+     * @retval false If result holds the exact difference.
+     *
+     * @see saturating_subtract()
+     */
+    bool checked_subtract(int a, int b, int &result) const;
+
+    /**
+     * @brief Subtracts two integer spans element-wise and records overflowing lanes.
+     *
+     * Writes the wrapped difference of every lane to out and sets bit \f$i \bmod 64\f$
+     * of word \f$\lfloor i / 64 \rfloor\f$ in overflow when lane i overflowed.
+     * Overflow detection is folded into the SIMD kernel, so no per-lane branch
+     * is taken.
+     *
+     * @param[in] a The first operand span.
+     * @param[in] b The second operand span.
+     * @param[out] out The destination span.
+     * @param[out] overflow The per-lane overflow bitmask, one bit per lane.
+     *
+     * @return The number of lanes that overflowed.
+     *
+     * @throws std::invalid_argument If the spans differ in size or overflow
+     *         holds fewer than \f$\lceil n / 64 \rceil\f$ words.
+     *
+     * @pre a.size() == b.size() == out.size()
+     * @post Bits past the last lane in the final overflow word are zero.
+     */
+    std::size_t checked_subtract(std::span<const int> a, std::span<const int> b, std::span<int> out,
+                                 std::span<std::uint64_t> overflow) const;
+
+    /**
+     * @brief Subtracts two integers, clamping the result to the int range.
+     *
+     * @param[in] a The first operand.
+     * @param[in] b The second operand.
+     *
+     * @return The difference \f$a - b\f$ clamped to [INT_MIN, INT_MAX].
+     *
+     * @see checked_subtract()
+     */
+    int saturating_subtract(int a, int b) const;
+
+    /**
+     * @brief Subtracts two integer spans element-wise with saturation.
+     *
+     * @param[in] a The first operand span.
+     * @param[in] b The second operand span.
+     * @param[out] out The destination span receiving the clamped differences.
+     *
+     * @throws std::invalid_argument If the spans differ in size.
+     *
+     * @pre a.size() == b.size() == out.size()
+     */
+    void saturating_subtract(std::span<const int> a, std::span<const int> b, std::span<int> out) const;
+
+    /**
+     * @brief Multiplies two integers and reports whether the result overflowed.
+     *
+     * @param[in] a The first operand.
+     * @param[in] b The second operand.
+     * @param[out] result The wrapped product, identical to multiply(a, b).
+     *
+     * @retval true  If the exact product \f$a \times b\f$ does not fit in an int.
+     * @retval false If result holds the exact product.
+     *
+     * @see saturating_multiply()
+     */
+    bool checked_multiply(int a, int b, int &result) const;
+
+    /**
+     * @brief Multiplies two integer spans element-wise and records overflowing lanes.
+     *
+     * Writes the wrapped product of every lane to out and sets bit \f$i \bmod 64\f$
+     * of word \f$\lfloor i / 64 \rfloor\f$ in overflow when lane i overflowed.
+     * Overflow detection is folded into the SIMD kernel, so no per-lane branch
+     * is taken.
+     *
+     * @param[in] a The first operand span.
+     * @param[in] b The second operand span.
+     * @param[out] out The destination span.
+     * @param[out] overflow The per-lane overflow bitmask, one bit per lane.
+     *
+     * @return The number of lanes that overflowed.
+     *
+     * @throws std::invalid_argument If the spans differ in size or overflow
+     *         holds fewer than \f$\lceil n / 64 \rceil\f$ words.
+     *
+     * @pre a.size() == b.size() == out.size()
+     * @post Bits past the last lane in the final overflow word are zero.
+     */
+    std::size_t checked_multiply(std::span<const int> a, std::span<const int> b, std::span<int> out,
+                                 std::span<std::uint64_t> overflow) const;
+
+    /**
+     * @brief Multiplies two integers, clamping the result to the int range.
+     *
+     * @param[in] a The first operand.
+     * @param[in] b The second operand.
+     *
+     * @return The product \f$a \times b\f$ clamped to [INT_MIN, INT_MAX].
+     *
+     * @see checked_multiply()
+     */
+    int saturating_multiply(int a, int b) const;
+
+    /**
+     * @brief Multiplies two integer spans element-wise with saturation.
+     *
+     * @param[in] a The first operand span.
+     * @param[in] b The second operand span.
+     * @param[out] out The destination span receiving the clamped products.
+     *
+     * @throws std::invalid_argument If the spans differ in size.
+     *
+     * @pre a.size() == b.size() == out.size()
+     */
+    void saturating_multiply(std::span<const int> a, std::span<const int> b, std::span<int> out) const;
+
     /**
      * @brief Divides two integers and returns the quotient.
      *
@@ -118,6 +622,27 @@ namespace cpp_concept
      */
     double divide(int numerator, int denominator) const;
 
+    /**
+     * @brief Divides a span of integers by a common denominator.
+     *
+     * Produces the same values as calling divide(numerator, denominator) for
+     * every element. The denominator is validated once and turned into a
+     * Divider, so the inner loop runs a multiply-high and shift instead of a
+     * hardware divide.
+     *
+     * @param[in] numerators The dividends.
+     * @param[in] denominator The divisor shared by all lanes.
+     * @param[out] out The destination span receiving the quotients.
+     *
+     * @throws std::invalid_argument If denominator is zero or the spans differ in size.
+     *
+     * @pre denominator != 0
+     * @pre numerators.size() == out.size()
+     *
+     * @see Divider
+     */
+    void divide(std::span<const int> numerators, int denominator, std::span<double> out) const;
+
     /**
      * @brief Returns a greeting for the provided text.
      *
@@ -164,6 +689,10 @@ namespace cpp_concept
      * Calculates \f$n! = n \times (n-1) \times \cdots \times 1\f$ where
      * \f$0! = 1\f$ by convention.
      *
+     * \f$n! \bmod 2^{64}\f$ is zero from n = 66 on, so a table of the first
+     * 66 values generated at compile time covers every n. A call is a bounds
+     * check and a load, and folds to a constant in constant expressions.
+     *
      * @param[in] n The non-negative integer.
      *
      * @return The factorial \f$n!\f$.
@@ -171,13 +700,94 @@ namespace cpp_concept
      * @throws std::invalid_argument If n is negative.
      *
      * @pre n >= 0
-     * @post Result >= 1.
+     * @post Result >= 1 for n <= 20.
      *
-     * @warning Values of n > 20 may cause overflow for 64-bit integers.
+     * @warning Values of n > 20 overflow 64-bit integers; the result is then
+     *          \f$n! \bmod 2^{64}\f$.
      *
+     * @see factorial128()
+     * @see factorial_big()
+     * @see ModularCombinatorics
      * @see fibonacci()
      */
-    unsigned long long factorial(int n) const;
+    constexpr unsigned long long factorial(int n) const
+    {
+      if (n < 0)
+      {
+        throw std::invalid_argument("Negative input not allowed");
+      }
+
+      const auto index = static_cast<std::size_t>(n);
+      return index < factorial_table_.size() ? factorial_table_[index] : 0;
+    }
+
+    /**
+     * @brief Computes the factorial of a non-negative integer n in 128 bits.
+     *
+     * Reads every exact value, n <= 34, from a table generated at compile
+     * time. Larger n continue the product from 34! modulo \f$2^{128}\f$,
+     * which is zero from 130! on.
+     *
+     * @param[in] n The non-negative integer.
+     *
+     * @return \f$n! \bmod 2^{128}\f$, which is \f$n!\f$ for n <= 34.
+     *
+     * @throws std::invalid_argument If n is negative.
+     *
+     * @see factorial()
+     * @see factorial256()
+     */
+    constexpr uint128_t factorial128(int n) const
+    {
+      return factorial_wide(n, factorial128_table_, 130);
+    }
+
+    /**
+     * @brief Computes the factorial of a non-negative integer n in 256 bits.
+     *
+     * Reads every exact value, n <= 57, from a table generated at compile
+     * time. Larger n continue the product from 57! modulo \f$2^{256}\f$,
+     * which is zero from 258! on.
+     *
+     * @param[in] n The non-negative integer.
+     *
+     * @return \f$n!\f$ for n <= 57; beyond, \f$n! \bmod 2^{256}\f$ read as
+     *         two's complement, which may be negative.
+     *
+     * @throws std::invalid_argument If n is negative.
+     *
+     * @see factorial128()
+     * @see factorial_big()
+     */
+    constexpr Int256 factorial256(int n) const
+    {
+      return factorial_wide(n, factorial256_table_, 258);
+    }
+
+    /**
+     * @brief Computes the factorial of a non-negative integer n exactly.
+     *
+     * Uses Luschny's prime-swing algorithm: \f$n! = \lfloor n/2 \rfloor!^2
+     * \cdot n\wr\f$, where the swing \f$n\wr = n! / \lfloor n/2 \rfloor!^2\f$
+     * has a prime factorization read off the quotients
+     * \f$\lfloor n / p^k \rfloor\f$. Only the odd part is multiplied out;
+     * the \f$n - \mathrm{popcount}(n)\f$ factors of two are a final shift.
+     * Each swing is a product of prime powers formed by balanced binary
+     * splitting, whose subproducts run on separate threads.
+     *
+     * @param[in] n The non-negative integer.
+     * @param[in] threads The maximum number of threads, 0 for one per hardware thread.
+     *
+     * @return The factorial \f$n!\f$.
+     *
+     * @throws std::invalid_argument If n is negative.
+     *
+     * @note The primes up to n are sieved first, which takes 8 bytes per
+     *       prime on top of the result.
+     *
+     * @see factorial()
+     */
+    BigInt factorial_big(int n, unsigned threads = 0) const;
 
     /**
      * @brief Performs linear interpolation between two points.
@@ -201,13 +811,41 @@ namespace cpp_concept
      * @pre x0 != x1 (points must have distinct x-coordinates).
      *
      * @note Extrapolation occurs when x is outside the range \f$[x_0, x_1]\f$.
+     *
+     * @see Spline
      */
     double spline(double x0, double y0, double x1, double y1, double x) const;
 
+    /**
+     * @brief Builds a natural cubic spline through many points.
+     *
+     * Validates the points and solves for the cubic coefficients once; the
+     * returned Spline then evaluates points and spans without revalidating.
+     *
+     * @param[in] x The knot positions, strictly increasing.
+     * @param[in] y The values at the knots.
+     *
+     * @return The natural cubic spline through \f$(x_i, y_i)\f$.
+     *
+     * @throws std::invalid_argument If the spans differ in size, hold fewer
+     *         than two knots, or x is not strictly increasing.
+     *
+     * @note With two knots the spline is the line of the overload above.
+     *
+     * @see Spline
+     */
+    Spline spline(std::span<const double> x, std::span<const double> y) const;
+
     /**
      * @brief Computes the nth Fibonacci number.
      *
-     * Calculates the Fibonacci sequence defined by:
+     * Reads every exact value, n <= 93, from a table generated at compile
+     * time, so such a call is a bounds check and a load and folds to a
+     * constant in constant expressions. Larger n are evaluated by fast
+     * doubling in \f$O(\log n)\f$ steps, using
+     * \f$F(2k) = F(k) (2F(k+1) - F(k))\f$ and
+     * \f$F(2k+1) = F(k)^2 + F(k+1)^2\f$. Calculates the Fibonacci sequence
+     * defined by:
      * \f[
      *   F(n) = \begin{cases}
      *     0 & \text{if } n = 0 \\
@@ -225,18 +863,186 @@ namespace cpp_concept
      * @pre n >= 0
      * @post Result >= 0.
      *
-     * @warning Values of n > 93 may cause overflow for 64-bit integers.
+     * @warning Values of n > 93 overflow 64-bit integers; the result is then
+     *          \f$F(n) \bmod 2^{64}\f$. Use checked_fibonacci() to detect it.
      *
      * @see factorial()
+     * @see fibonacci128()
+     * @see fibonacci256()
+     * @see fibonacci_big()
+     * @see fibonacci_mod()
+     */
+    constexpr unsigned long long fibonacci(int n) const
+    {
+      if (n < 0)
+      {
+        throw std::invalid_argument("Negative input not allowed");
+      }
+
+      const auto index = static_cast<unsigned>(n);
+      if (index < fibonacci_table_.size())
+      {
+        return fibonacci_table_[index];
+      }
+
+      return fibonacci_doubling<unsigned long long>(index);
+    }
+
+    /**
+     * @brief Computes the nth Fibonacci number in 128 bits.
+     *
+     * Runs the fast doubling of fibonacci() on 128-bit integers, which holds
+     * every Fibonacci number up to \f$F(186)\f$ exactly.
+     *
+     * @param[in] n The index of the Fibonacci number (0-indexed).
+     *
+     * @return \f$F(n) \bmod 2^{128}\f$, which is \f$F(n)\f$ for n <= 186.
+     *
+     * @throws std::invalid_argument If n is negative.
+     *
+     * @see fibonacci()
+     */
+    uint128_t fibonacci128(int n) const;
+
+    /**
+     * @brief Computes the nth Fibonacci number and reports whether it overflowed.
+     *
+     * @param[in] n The index of the Fibonacci number (0-indexed).
+     * @param[out] result The wrapped value, identical to fibonacci(n).
+     *
+     * @retval true  If \f$F(n)\f$ does not fit in 64 bits, that is n > 93.
+     * @retval false If result holds the exact value.
+     *
+     * @throws std::invalid_argument If n is negative.
+     *
+     * @see fibonacci()
      */
-    unsigned long long fibonacci(int n) const;
+    bool checked_fibonacci(int n, unsigned long long &result) const;
+
+    /**
+     * @brief Computes the nth Fibonacci number in 128 bits and reports whether it overflowed.
+     *
+     * @param[in] n The index of the Fibonacci number (0-indexed).
+     * @param[out] result The wrapped value, identical to fibonacci128(n).
+     *
+     * @retval true  If \f$F(n)\f$ does not fit in 128 bits, that is n > 186.
+     * @retval false If result holds the exact value.
+     *
+     * @throws std::invalid_argument If n is negative.
+     *
+     * @see fibonacci128()
+     */
+    bool checked_fibonacci(int n, uint128_t &result) const;
+
+    /**
+     * @brief Computes the nth Fibonacci number in 256 bits.
+     *
+     * Runs the fast doubling of fibonacci() on Int256, which holds every
+     * Fibonacci number up to \f$F(368)\f$ exactly.
+     *
+     * @param[in] n The index of the Fibonacci number (0-indexed).
+     *
+     * @return \f$F(n)\f$ for n <= 368; beyond, \f$F(n) \bmod 2^{256}\f$ read
+     *         as two's complement, which may be negative.
+     *
+     * @throws std::invalid_argument If n is negative.
+     *
+     * @see fibonacci128()
+     * @see fibonacci_big()
+     */
+    Int256 fibonacci256(int n) const;
+
+    /**
+     * @brief Computes the nth Fibonacci number in 256 bits and reports whether it overflowed.
+     *
+     * @param[in] n The index of the Fibonacci number (0-indexed).
+     * @param[out] result The wrapped value, identical to fibonacci256(n).
+     *
+     * @retval true  If \f$F(n)\f$ does not fit in Int256, that is n > 368.
+     * @retval false If result holds the exact value.
+     *
+     * @throws std::invalid_argument If n is negative.
+     *
+     * @see fibonacci256()
+     */
+    bool checked_fibonacci(int n, Int256 &result) const;
+
+    /**
+     * @brief Computes the nth Fibonacci number exactly.
+     *
+     * Walks down the bits of n holding \f$F(k)\f$ and \f$F(k-1)\f$, so every
+     * step costs two big squarings:
+     * \f[
+     *   F(2k+1) = 4F(k)^2 - F(k-1)^2 + 2(-1)^k, \quad
+     *   F(2k-1) = F(k)^2 + F(k-1)^2, \quad
+     *   F(2k) = F(2k+1) - F(2k-1)
+     * \f]
+     * The final squarings dominate, so the cost is a small multiple of one
+     * Karatsuba square of \f$0.694 n\f$ bits.
+     *
+     * @param[in] n The index of the Fibonacci number (0-indexed).
+     *
+     * @return \f$F(n)\f$.
+     *
+     * @throws std::invalid_argument If n is negative.
+     *
+     * @see fibonacci()
+     * @see BigInt::write_decimal()
+     */
+    BigInt fibonacci_big(int n) const;
+
+    /**
+     * @brief Computes the nth Fibonacci number modulo m.
+     *
+     * Reduces n modulo the Pisano period \f$\pi(m)\f$, the period of the
+     * sequence \f$F(n) \bmod m\f$, then runs fast doubling on the remaining
+     * bits. The odd part of m is handled in Montgomery form and the
+     * power-of-two part in wrapping arithmetic, joined by the Chinese
+     * remainder theorem, so no step divides by m.
+     *
+     * \f$\pi(m)\f$ is found from the factorization of m and cached per
+     * modulus, so the first call for a modulus is slower than later ones.
+     *
+     * @param[in] n The index of the Fibonacci number (0-indexed).
+     * @param[in] m The modulus.
+     *
+     * @return \f$F(n) \bmod m\f$.
+     *
+     * @throws std::invalid_argument If m is zero.
+     *
+     * @note Thread safety: The period cache is guarded by a mutex, so
+     *       concurrent calls are safe.
+     *
+     * @see fibonacci()
+     */
+    std::uint64_t fibonacci_mod(std::uint64_t n, std::uint64_t m) const;
+
+    /**
+     * @brief Computes Fibonacci numbers modulo m for a span of indices.
+     *
+     * Looks up the Pisano period and prepares the Montgomery constants once,
+     * then evaluates every index against them.
+     *
+     * @param[in] indices The indices of the Fibonacci numbers.
+     * @param[in] m The modulus shared by all indices.
+     * @param[out] out Receives \f$F(indices_i) \bmod m\f$.
+     *
+     * @throws std::invalid_argument If the span sizes differ or m is zero.
+     *
+     * @see fibonacci_mod(std::uint64_t, std::uint64_t)
+     */
+    void fibonacci_mod(std::span<const std::uint64_t> indices, std::uint64_t m, std::span<std::uint64_t> out) const;
 
     /**
      * @brief Checks if the given integer is a prime number.
      *
      * A prime number is a natural number greater than 1 that has no
-     * positive divisors other than 1 and itself.
+     * positive divisors other than 1 and itself. Accepts any integer type of
+     * up to 64 bits, so int, unsigned and long arguments all resolve here
+     * without ambiguity; negative values are not prime, and every other
+     * value is tested by is_prime(std::uint64_t).
      *
+     * @tparam T The integral type of n, at most 64 bits wide.
      * @param[in] n The integer to check.
      *
      * @retval true  If n is a prime number.
@@ -245,8 +1051,188 @@ namespace cpp_concept
      * @note 0 and 1 are not considered prime numbers.
      *
      * @see is_even()
+     * @see is_prime(std::uint64_t)
+     */
+    template <std::integral T>
+      requires(sizeof(T) <= sizeof(std::uint64_t))
+    bool is_prime(T n) const
+    {
+      if constexpr (std::signed_integral<T>)
+      {
+        if (n < 0)
+        {
+          return false;
+        }
+      }
+
+      // The non-template overload wins for std::uint64_t, so this never recurses
+      return is_prime(static_cast<std::uint64_t>(n));
+    }
+
+    /**
+     * @brief Checks if the given 64-bit integer is a prime number.
+     *
+     * Rejects multiples of the primes below 64 by trial division, then runs a
+     * deterministic Miller-Rabin test with 128-bit modular multiplication.
+     * Seven fixed bases suffice for every \f$n < 2^{64}\f$, so the result is
+     * exact and the worst case costs a few microseconds.
+     *
+     * @param[in] n The integer to check.
+     *
+     * @retval true  If n is a prime number.
+     * @retval false If n is not prime (including n <= 1).
+     *
+     * @see is_prime(T)
+     * @see PrimeTable for a precomputed lookup over the 32-bit domain.
      */
-    bool is_prime(int n) const;
+    bool is_prime(std::uint64_t n) const;
+
+    /**
+     * @brief Tests a span of 32-bit integers for primality.
+     *
+     * Sets bit \f$i \bmod 64\f$ of word \f$\lfloor i / 64 \rfloor\f$ in mask when
+     * values[i] is prime, so the mask can drive downstream filtering
+     * directly. On AVX2 hosts, eight lanes at a time are trial-divided by the
+     * primes below 64 with multiply-by-inverse tests; the lanes that survive
+     * are packed together and finished by a Montgomery-form Miller-Rabin
+     * with the bases 2, 7 and 61, which is exact for every 32-bit input.
+     * Other hosts run the same algorithm one lane at a time.
+     *
+     * @param[in] values The integers to test.
+     * @param[out] mask The per-lane primality bitmask, one bit per lane.
+     *
+     * @return The number of primes in values.
+     *
+     * @throws std::invalid_argument If mask holds fewer than \f$\lceil n / 64 \rceil\f$ words.
+     *
+     * @post Bit i is set exactly when is_prime(std::uint64_t{values[i]}) is true.
+     * @post Bits past the last lane in the final mask word are zero.
+     *
+     * @see is_prime(std::uint64_t)
+     */
+    std::size_t is_prime(std::span<const std::uint32_t> values, std::span<std::uint64_t> mask) const;
+
+    /**
+     * @brief Streams the primes of a range to a callback in increasing order.
+     *
+     * Runs a segmented sieve of Eratosthenes on a mod-30 wheel: every byte
+     * of a 32 KiB segment covers 30 integers, one bit per residue coprime to
+     * 30. Runs of adjacent segments are sieved on threads spawned once per
+     * call, and the primes of each run are handed to the callback on the
+     * calling thread as soon as every earlier run has been delivered, while
+     * the threads sieve the next runs. Memory therefore stays proportional
+     * to the thread count and \f$\sqrt{last}\f$, not to the length of the
+     * range.
+     *
+     * @param[in] first The inclusive lower bound.
+     * @param[in] last The exclusive upper bound.
+     * @param[in] callback Invoked with consecutive, non-empty, ascending spans of primes.
+     * @param[in] threads The maximum number of threads, 0 for one per hardware thread.
+     *
+     * @throws std::invalid_argument If last exceeds \f$2^{62}\f$.
+     * @throws Any exception thrown by callback, after which no further calls are made.
+     *
+     * @note An empty range, first >= last, makes no calls.
+     * @note The primes below \f$\sqrt{last}\f$ take 4 bytes each, plus 16
+     *       bytes each per thread for their next multiple. Near the
+     *       \f$2^{62}\f$ cap there are \f$10^8\f$ of them, about 1.7 GB per
+     *       thread, so pass a small thread count there.
+     *
+     * @see primes_in()
+     * @see count_primes()
+     */
+    void for_each_prime(std::uint64_t first, std::uint64_t last,
+                        const std::function<void(std::span<const std::uint64_t>)> &callback,
+                        unsigned threads = 0) const;
+
+    /**
+     * @brief Lists the primes of a range.
+     *
+     * @param[in] first The inclusive lower bound.
+     * @param[in] last The exclusive upper bound.
+     * @param[in] threads The maximum number of threads, 0 for one per hardware thread.
+     *
+     * @return The primes p with first <= p < last, in increasing order.
+     *
+     * @throws std::invalid_argument If last exceeds \f$2^{62}\f$.
+     *
+     * @see for_each_prime()
+     */
+    std::vector<std::uint64_t> primes_in(std::uint64_t first, std::uint64_t last, unsigned threads = 0) const;
+
+    /**
+     * @brief Counts the primes of a range.
+     *
+     * Sieves like for_each_prime(), but splits the whole range across the
+     * threads up front and only counts the bits left in each segment.
+     *
+     * @param[in] first The inclusive lower bound.
+     * @param[in] last The exclusive upper bound.
+     * @param[in] threads The maximum number of threads, 0 for one per hardware thread.
+     *
+     * @return The number of primes p with first <= p < last.
+     *
+     * @throws std::invalid_argument If last exceeds \f$2^{62}\f$.
+     *
+     * @see for_each_prime()
+     */
+    std::uint64_t count_primes(std::uint64_t first, std::uint64_t last, unsigned threads = 0) const;
+
+    /**
+     * @brief Counts the primes up to x without sieving them.
+     *
+     * Runs Lucy_Hedgehog's variant of the Legendre sum, which only tracks the
+     * \f$2\sqrt{x}\f$ distinct values of \f$\lfloor x / i \rfloor\f$. Takes
+     * \f$O(x^{3/4} / \log x)\f$ time and \f$O(\sqrt{x})\f$ memory, against
+     * the \f$O(x \log \log x)\f$ time of count_primes(). The update for each
+     * sieving prime is split across threads once it is large enough.
+     *
+     * @param[in] x The inclusive upper bound.
+     * @param[in] threads The maximum number of threads, 0 for one per hardware thread.
+     *
+     * @return \f$\pi(x)\f$, the number of primes p <= x.
+     *
+     * @throws std::invalid_argument If x exceeds \f$2^{62}\f$.
+     *
+     * @see count_primes()
+     */
+    std::uint64_t prime_pi(std::uint64_t x, unsigned threads = 0) const;
+
+    /**
+     * @brief Factors a 64-bit integer into primes.
+     *
+     * Strips factors below 1024 by exact division with precomputed modular
+     * inverses, then splits what remains with Brent's variant of Pollard's
+     * rho in Montgomery form, testing every cofactor with the deterministic
+     * Miller-Rabin test of is_prime(std::uint64_t). Rho needs about
+     * \f$\sqrt{p}\f$ steps to find the factor p, so the hardest inputs, 64-bit
+     * semiprimes with two 32-bit factors, take a few hundred microseconds.
+     *
+     * @param[in] n The integer to factor.
+     *
+     * @return The prime factors of n with multiplicity, in increasing order; empty for n = 1.
+     *
+     * @throws std::invalid_argument If n is zero.
+     *
+     * @post The product of the result is n.
+     *
+     * @see is_prime(std::uint64_t)
+     */
+    std::vector<std::uint64_t> factorize(std::uint64_t n) const;
+
+    /**
+     * @brief Factors a span of 64-bit integers across threads.
+     *
+     * @param[in] values The integers to factor.
+     * @param[in] threads The maximum number of threads, 0 for one per hardware thread.
+     *
+     * @return factorize(values[i]) at index i.
+     *
+     * @throws std::invalid_argument If any value is zero, before any work is done.
+     *
+     * @see factorize(std::uint64_t)
+     */
+    std::vector<std::vector<std::uint64_t>> factorize(std::span<const std::uint64_t> values, unsigned threads = 0) const;
 
     /**
      * @brief Finds the maximum element in a vector of integers.
@@ -260,8 +1246,240 @@ namespace cpp_concept
      * @pre !vec.empty()
      * @post Result is an element of vec.
      * @post Result >= all elements in vec.
+     *
+     * @see find_max(std::span<const int>)
      */
     int find_max(const std::vector<int> &vec) const;
+
+    /**
+     * @brief Finds the maximum element in a span of integers.
+     *
+     * Reduces the span with a SIMD max-of-lanes (AVX-512, AVX2 or SSE2)
+     * followed by a horizontal reduce, so no branch is taken per element.
+     * Accepting a span lets callers pass mapped or pooled buffers without
+     * copying them into a vector.
+     *
+     * @param[in] values The span to search.
+     *
+     * @return The maximum value in the span.
+     *
+     * @throws std::invalid_argument If the span is empty.
+     *
+     * @pre !values.empty()
+     * @post Result >= all elements in values.
+     *
+     * @see argmax()
+     * @see find_max_parallel()
+     * @see RangeMax
+     * @see SlidingWindowMax
+     */
+    int find_max(std::span<const int> values) const;
+
+    /**
+     * @brief Finds the maximum element of a span using multiple threads.
+     *
+     * Splits the span into contiguous chunks, reduces each chunk with the
+     * SIMD kernel of find_max() on its own thread and combines the partial
+     * maxima. Inputs too small to amortize thread start-up run on the calling
+     * thread only.
+     *
+     * @param[in] values The span to search.
+     * @param[in] threads The maximum number of threads, 0 for one per hardware thread.
+     *
+     * @return The maximum value in the span.
+     *
+     * @throws std::invalid_argument If the span is empty.
+     *
+     * @pre !values.empty()
+     *
+     * @see find_max()
+     */
+    int find_max_parallel(std::span<const int> values, unsigned threads = 0) const;
+
+    /**
+     * @brief Finds the index of the first maximum element in a span.
+     *
+     * Scans the span in cache-sized blocks: each block is reduced with the SIMD
+     * max kernel, and only a block that raises the running maximum is searched
+     * again for its position while it is still in cache.
+     *
+     * @param[in] values The span to search.
+     *
+     * @return The smallest index i such that values[i] equals find_max(values).
+     *
+     * @throws std::invalid_argument If the span is empty.
+     *
+     * @pre !values.empty()
+     * @post values[result] >= all elements in values.
+     *
+     * @see find_max()
+     * @see argmax_parallel()
+     */
+    std::size_t argmax(std::span<const int> values) const;
+
+    /**
+     * @brief Finds the index of the first maximum element using multiple threads.
+     *
+     * @param[in] values The span to search.
+     * @param[in] threads The maximum number of threads, 0 for one per hardware thread.
+     *
+     * @return The smallest index i such that values[i] equals find_max(values).
+     *
+     * @throws std::invalid_argument If the span is empty.
+     *
+     * @pre !values.empty()
+     *
+     * @see argmax()
+     */
+    std::size_t argmax_parallel(std::span<const int> values, unsigned threads = 0) const;
+
+    /**
+     * @brief Finds the k largest elements of a span.
+     *
+     * Keeps the current k best values in a min-heap whose root is the
+     * admission threshold. The input is scanned in blocks of 64 with a SIMD
+     * compare against that threshold, and only lanes above it are offered to
+     * the heap, so the input is never sorted or copied.
+     *
+     * @param[in] values The span to search.
+     * @param[in] k The number of elements to select.
+     *
+     * @return The min(k, values.size()) largest values, in descending order.
+     *
+     * @note Runs in O(n + m log k) for m heap insertions; on shuffled input m
+     *       grows only with k log(n / k).
+     *
+     * @see find_max()
+     * @see find_top_k_parallel()
+     */
+    std::vector<int> find_top_k(std::span<const int> values, std::size_t k) const;
+
+    /**
+     * @brief Finds the k largest elements of a span using multiple threads.
+     *
+     * Selects up to k candidates from each contiguous chunk on its own thread
+     * with the kernel of find_top_k(), then selects the k largest of the
+     * merged candidate sets.
+     *
+     * @param[in] values The span to search.
+     * @param[in] k The number of elements to select.
+     * @param[in] threads The maximum number of threads, 0 for one per hardware thread.
+     *
+     * @return The same values as find_top_k(values, k).
+     *
+     * @see find_top_k()
+     */
+    std::vector<int> find_top_k_parallel(std::span<const int> values, std::size_t k, unsigned threads = 0) const;
+
+    /**
+     * @brief Computes min, max, their first indices, sum and count in one pass.
+     *
+     * Reads the input once with a SIMD kernel that tracks the running minimum,
+     * maximum and a 64-bit sum, instead of separate passes for each statistic.
+     *
+     * @param[in] values The span to summarize.
+     * @param[in] offset Index of values[0] in the enclosing sequence, added to argmin and argmax.
+     *
+     * @return The summary of values; an empty span yields a default Summary.
+     *
+     * @post result.count == values.size()
+     *
+     * @see Summary::merge()
+     * @see summarize_parallel()
+     */
+    Summary summarize(std::span<const int> values, std::size_t offset = 0) const;
+
+    /**
+     * @brief Computes a Summary using multiple threads.
+     *
+     * Summarizes contiguous chunks on separate threads and merges the
+     * partial summaries.
+     *
+     * @param[in] values The span to summarize.
+     * @param[in] threads The maximum number of threads, 0 for one per hardware thread.
+     *
+     * @return The same Summary as summarize(values).
+     *
+     * @see summarize()
+     */
+    Summary summarize_parallel(std::span<const int> values, unsigned threads = 0) const;
+
+  private:
+    // n! mod 2^64 for n < 66; every larger factorial has at least 64 factors of two
+    static constexpr std::array<unsigned long long, 66> factorial_table_ = []
+    {
+      std::array<unsigned long long, 66> table{};
+      table[0] = 1;
+      for (std::size_t i = 1; i < table.size(); ++i)
+      {
+        table[i] = table[i - 1] * i;
+      }
+      return table;
+    }();
+
+    // n! for every n whose value fits in 128 bits
+    static constexpr std::array<uint128_t, 35> factorial128_table_ = []
+    {
+      std::array<uint128_t, 35> table{};
+      table[0] = 1;
+      for (std::size_t i = 1; i < table.size(); ++i)
+      {
+        table[i] = table[i - 1] * i;
+      }
+      return table;
+    }();
+
+    // n! for every n whose value fits in Int256
+    static constexpr std::array<Int256, 58> factorial256_table_ = []
+    {
+      std::array<Int256, 58> table{};
+      table[0] = 1;
+      for (std::size_t i = 1; i < table.size(); ++i)
+      {
+        table[i] = table[i - 1] * i;
+      }
+      return table;
+    }();
+
+    // n! modulo 2^bits from a table of the exact values; zero_from is the
+    // first n whose factorial has at least bits factors of two
+    template <typename T, std::size_t size>
+    static constexpr T factorial_wide(int n, const std::array<T, size> &table, std::size_t zero_from)
+    {
+      if (n < 0)
+      {
+        throw std::invalid_argument("Negative input not allowed");
+      }
+
+      const auto index = static_cast<std::size_t>(n);
+      if (index < size)
+      {
+        return table[index];
+      }
+      if (index >= zero_from)
+      {
+        return 0;
+      }
+
+      T result = table.back();
+      for (std::size_t i = size; i <= index; ++i)
+      {
+        result *= i;
+      }
+      return result;
+    }
+
+    // F(n) for every n whose value fits in 64 bits
+    static constexpr std::array<unsigned long long, 94> fibonacci_table_ = []
+    {
+      std::array<unsigned long long, 94> table{};
+      table[1] = 1;
+      for (std::size_t i = 2; i < table.size(); ++i)
+      {
+        table[i] = table[i - 1] + table[i - 2];
+      }
+      return table;
+    }();
   };
 
 } // namespace cpp_concept
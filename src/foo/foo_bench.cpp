@@ -0,0 +1,1050 @@
+#include <benchmark/benchmark.h>
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
+#include <new>
+#include <ostream>
+#include <random>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "foo/foo.hpp"
+#include "foo/mod_context.hpp"
+#include "foo/modular_combinatorics.hpp"
+#include "foo/prime_table.hpp"
+#include "foo/spline.hpp"
+
+using namespace cpp_concept;
+
+namespace
+{
+
+  // Live and peak heap bytes, counted by the operator new and delete below
+  // only while a PeakHeap is alive. Unlike ru_maxrss, which never falls,
+  // this gives each benchmark its own peak whatever ran before it
+  std::atomic<bool> heap_counting{false};
+  std::atomic<std::int64_t> heap_live{0};
+  std::atomic<std::int64_t> heap_peak{0};
+
+  void heap_count(std::int64_t bytes) noexcept
+  {
+    if (heap_counting.load(std::memory_order_relaxed))
+    {
+      const std::int64_t live = heap_live.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+      std::int64_t peak = heap_peak.load(std::memory_order_relaxed);
+      while (live > peak && !heap_peak.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+      {
+      }
+    }
+  }
+
+  // Highest growth of the live heap bytes since construction, so memory
+  // allocated in the Arrange step is left out
+  class PeakHeap
+  {
+  public:
+    PeakHeap() noexcept
+    {
+      heap_live.store(0);
+      heap_peak.store(0);
+      heap_counting.store(true);
+    }
+
+    PeakHeap(const PeakHeap &) = delete;
+    PeakHeap &operator=(const PeakHeap &) = delete;
+
+    ~PeakHeap()
+    {
+      heap_counting.store(false);
+    }
+
+    benchmark::Counter counter() const
+    {
+      return benchmark::Counter(static_cast<double>(heap_peak.load()), benchmark::Counter::kDefaults,
+                                benchmark::Counter::kIs1024);
+    }
+  };
+
+  // Uniformly distributed values, shared by every benchmark of the same size
+  const std::vector<int> &dataset(std::size_t size)
+  {
+    static std::vector<int> values;
+    if (values.size() != size)
+    {
+      std::mt19937 engine(42);
+      std::uniform_int_distribution<int> distribution;
+      values.resize(size);
+      std::generate(values.begin(), values.end(), [&] { return distribution(engine); });
+    }
+
+    return values;
+  }
+
+  // A BigInt of exactly the given number of uniformly random limbs
+  BigInt random_big_int(std::size_t limbs, std::uint64_t seed)
+  {
+    std::mt19937_64 engine(seed);
+    std::vector<std::uint64_t> values(limbs);
+    std::generate(values.begin(), values.end(), std::ref(engine));
+    values.back() |= 1;
+
+    return BigInt::from_limbs(values);
+  }
+
+  // Input sizes {2^20, 2^24, 2^26} against k in {10, 100, 1000}
+  void top_k_args(benchmark::internal::Benchmark *bench)
+  {
+    for (std::int64_t size : {std::int64_t{1} << 20, std::int64_t{1} << 24, std::int64_t{1} << 26})
+    {
+      for (std::int64_t k : {10, 100, 1000})
+      {
+        bench->Args({size, k});
+      }
+    }
+  }
+
+} // namespace
+
+// Each block carries its size in front, so operator delete can count it
+// too; the array and nothrow forms default to these two
+void *operator new(std::size_t size)
+{
+  void *block = std::malloc(size + alignof(std::max_align_t));
+  if (block == nullptr)
+  {
+    throw std::bad_alloc();
+  }
+  *static_cast<std::size_t *>(block) = size;
+  heap_count(static_cast<std::int64_t>(size));
+
+  return static_cast<std::byte *>(block) + alignof(std::max_align_t);
+}
+
+void operator delete(void *pointer) noexcept
+{
+  if (pointer != nullptr)
+  {
+    void *block = static_cast<std::byte *>(pointer) - alignof(std::max_align_t);
+    heap_count(-static_cast<std::int64_t>(*static_cast<std::size_t *>(block)));
+    std::free(block);
+  }
+}
+
+void operator delete(void *pointer, std::size_t) noexcept
+{
+  operator delete(pointer);
+}
+
+static void BM_FindTopK(benchmark::State &state)
+{
+  // Arrange
+  Foo foo;
+  const auto &values = dataset(static_cast<std::size_t>(state.range(0)));
+  const auto k = static_cast<std::size_t>(state.range(1));
+
+  // Act
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(foo.find_top_k(values, k));
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FindTopK)->Apply(top_k_args)->Unit(benchmark::kMillisecond);
+
+static void BM_FindTopKParallel(benchmark::State &state)
+{
+  // Arrange
+  Foo foo;
+  const auto &values = dataset(static_cast<std::size_t>(state.range(0)));
+  const auto k = static_cast<std::size_t>(state.range(1));
+
+  // Act
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(foo.find_top_k_parallel(values, k));
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FindTopKParallel)->Apply(top_k_args)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// Baseline: std::partial_sort_copy leaves the input untouched, like find_top_k
+static void BM_PartialSortCopy(benchmark::State &state)
+{
+  // Arrange
+  const auto &values = dataset(static_cast<std::size_t>(state.range(0)));
+  std::vector<int> top(static_cast<std::size_t>(state.range(1)));
+
+  // Act
+  for (auto _ : state)
+  {
+    std::partial_sort_copy(values.begin(), values.end(), top.begin(), top.end(), std::greater<>{});
+    benchmark::DoNotOptimize(top.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PartialSortCopy)->Apply(top_k_args)->Unit(benchmark::kMillisecond);
+
+// Baseline: std::partial_sort reorders its input, so every iteration pays for a copy
+static void BM_PartialSort(benchmark::State &state)
+{
+  // Arrange
+  const auto &values = dataset(static_cast<std::size_t>(state.range(0)));
+  const auto k = static_cast<std::ptrdiff_t>(state.range(1));
+
+  // Act
+  for (auto _ : state)
+  {
+    std::vector<int> scratch(values);
+    std::partial_sort(scratch.begin(), scratch.begin() + k, scratch.end(), std::greater<>{});
+    benchmark::DoNotOptimize(scratch.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PartialSort)->Apply(top_k_args)->Unit(benchmark::kMillisecond);
+
+// Baseline: std::nth_element plus a sort of the k selected values, again on a copy
+static void BM_NthElement(benchmark::State &state)
+{
+  // Arrange
+  const auto &values = dataset(static_cast<std::size_t>(state.range(0)));
+  const auto k = static_cast<std::ptrdiff_t>(state.range(1));
+
+  // Act
+  for (auto _ : state)
+  {
+    std::vector<int> scratch(values);
+    std::nth_element(scratch.begin(), scratch.begin() + k - 1, scratch.end(), std::greater<>{});
+    std::sort(scratch.begin(), scratch.begin() + k, std::greater<>{});
+    benchmark::DoNotOptimize(scratch.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_NthElement)->Apply(top_k_args)->Unit(benchmark::kMillisecond);
+
+static void BM_Factorial(benchmark::State &state)
+{
+  // Arrange
+  Foo foo;
+  auto n = static_cast<int>(state.range(0));
+
+  // Act
+  for (auto _ : state)
+  {
+    // The call is inline now, so hide n to keep it from being hoisted
+    benchmark::DoNotOptimize(n);
+    benchmark::DoNotOptimize(foo.factorial(n));
+  }
+}
+BENCHMARK(BM_Factorial)->Arg(20)->Arg(65);
+
+// Baseline: the loop factorial() used to run
+static void BM_FactorialLoop(benchmark::State &state)
+{
+  // Arrange
+  auto n = static_cast<int>(state.range(0));
+
+  // Act
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(n);
+    unsigned long long result = 1;
+    for (int i = 2; i <= n; ++i)
+    {
+      result *= static_cast<unsigned long long>(i);
+    }
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_FactorialLoop)->Arg(20)->Arg(65);
+
+static void BM_FactorialBig(benchmark::State &state)
+{
+  // Arrange
+  Foo foo;
+  const auto n = static_cast<int>(state.range(0));
+  const auto threads = static_cast<unsigned>(state.range(1));
+
+  // Act
+  const PeakHeap heap;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(foo.factorial_big(n, threads));
+  }
+  state.counters["peak_heap"] = heap.counter();
+}
+BENCHMARK(BM_FactorialBig)
+    ->Args({10000, 1})
+    ->Args({100000, 1})
+    ->Args({1000000, 1})
+    ->Args({1000000, 0})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// Baseline: multiplying 2, 3, ..., n into a BigInt one factor at a time
+static void BM_FactorialBigProduct(benchmark::State &state)
+{
+  // Arrange
+  const auto n = static_cast<std::uint64_t>(state.range(0));
+
+  // Act
+  for (auto _ : state)
+  {
+    BigInt result = 1U;
+    for (std::uint64_t i = 2; i <= n; ++i)
+    {
+      result *= i;
+    }
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_FactorialBigProduct)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+static void BM_ModularCombinatoricsBuild(benchmark::State &state)
+{
+  // Arrange
+  const auto limit = static_cast<std::size_t>(state.range(0));
+
+  // Act
+  for (auto _ : state)
+  {
+    ModularCombinatorics mod(1000000007, limit);
+    benchmark::DoNotOptimize(mod.factorial(limit));
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * limit));
+}
+BENCHMARK(BM_ModularCombinatoricsBuild)->Arg(1000000)->Arg(10000000)->Unit(benchmark::kMillisecond);
+
+static void BM_ModularBinomial(benchmark::State &state)
+{
+  // Arrange
+  const ModularCombinatorics mod(1000000007, 1000000);
+  std::mt19937_64 engine(42);
+  std::uniform_int_distribution<std::uint64_t> dist(0, 1000000);
+  std::vector<std::uint64_t> n(4096);
+  std::vector<std::uint64_t> r(n.size());
+  for (std::size_t i = 0; i < n.size(); ++i)
+  {
+    n[i] = dist(engine);
+    r[i] = dist(engine) % (n[i] + 1);
+  }
+  std::vector<std::uint64_t> out(n.size());
+
+  // Act
+  for (auto _ : state)
+  {
+    mod.binomial(n, r, out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n.size()));
+}
+BENCHMARK(BM_ModularBinomial);
+
+// Baseline: factorial table only, inverting the denominator by Fermat's little theorem per query
+static void BM_ModularBinomialFermat(benchmark::State &state)
+{
+  // Arrange
+  constexpr std::uint64_t p = 1000000007;
+  std::vector<std::uint64_t> factorials(1000001, 1);
+  for (std::size_t i = 1; i < factorials.size(); ++i)
+  {
+    factorials[i] = factorials[i - 1] * i % p;
+  }
+  std::mt19937_64 engine(42);
+  std::uniform_int_distribution<std::uint64_t> dist(0, 1000000);
+  std::vector<std::uint64_t> n(4096);
+  std::vector<std::uint64_t> r(n.size());
+  for (std::size_t i = 0; i < n.size(); ++i)
+  {
+    n[i] = dist(engine);
+    r[i] = dist(engine) % (n[i] + 1);
+  }
+  const auto power = [](std::uint64_t base, std::uint64_t exponent)
+  {
+    std::uint64_t result = 1;
+    for (; exponent != 0; exponent >>= 1, base = base * base % p)
+    {
+      if (exponent & 1U)
+      {
+        result = result * base % p;
+      }
+    }
+    return result;
+  };
+
+  // Act
+  for (auto _ : state)
+  {
+    for (std::size_t i = 0; i < n.size(); ++i)
+    {
+      const std::uint64_t denominator = factorials[r[i]] * factorials[n[i] - r[i]] % p;
+      benchmark::DoNotOptimize(factorials[n[i]] * power(denominator, p - 2) % p);
+    }
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n.size()));
+}
+BENCHMARK(BM_ModularBinomialFermat);
+
+// out[i] = (a[i] * b[i] + c[i]) mod m over 4096 elements for a 32-bit and a
+// 64-bit prime, with ModContext against the integer divide per element
+static constexpr std::uint64_t mod_context_moduli[] = {998244353ULL, 18446744073709551557ULL};
+
+static void BM_ModContextMultiplyAdd(benchmark::State &state)
+{
+  // Arrange
+  const std::uint64_t m = mod_context_moduli[state.range(0)];
+  const bool divide = state.range(1) != 0;
+  std::mt19937_64 engine(42);
+  std::vector<std::uint64_t> a(4096), b(a.size()), c(a.size()), out(a.size());
+  for (std::size_t i = 0; i < a.size(); ++i)
+  {
+    a[i] = engine() % m;
+    b[i] = engine() % m;
+    c[i] = engine() % m;
+  }
+  const ModContext mod(m);
+  state.SetLabel(std::to_string(m) + (divide ? " divide" : " ModContext"));
+
+  // Act
+  for (auto _ : state)
+  {
+    if (divide)
+    {
+      for (std::size_t i = 0; i < a.size(); ++i)
+      {
+        out[i] = static_cast<std::uint64_t>((static_cast<uint128_t>(a[i]) * b[i] + c[i]) % m);
+      }
+    }
+    else
+    {
+      mod.multiply_add(a, b, c, out);
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * a.size()));
+}
+BENCHMARK(BM_ModContextMultiplyAdd)->ArgsProduct({{0, 1}, {0, 1}});
+
+static void BM_ModContextPower(benchmark::State &state)
+{
+  // Arrange
+  const std::uint64_t m = mod_context_moduli[state.range(0)];
+  const bool batch = state.range(1) != 0;
+  std::mt19937_64 engine(42);
+  std::vector<std::uint64_t> bases(1024), out(bases.size());
+  for (auto &x : bases)
+  {
+    x = engine() % m;
+  }
+  const ModContext mod(m);
+  state.SetLabel(std::to_string(m) + (batch ? " batch" : " scalar"));
+
+  // Act
+  for (auto _ : state)
+  {
+    if (batch)
+    {
+      mod.power(bases, m - 2, out);
+    }
+    else
+    {
+      for (std::size_t i = 0; i < bases.size(); ++i)
+      {
+        out[i] = mod.power(bases[i], m - 2);
+      }
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * bases.size()));
+}
+BENCHMARK(BM_ModContextPower)->ArgsProduct({{0, 1}, {0, 1}});
+
+static void BM_SplineEvaluate(benchmark::State &state)
+{
+  // Arrange
+  const auto knots = static_cast<std::size_t>(state.range(0));
+  const bool pairwise = state.range(1) == 1;
+  const bool uniform = state.range(1) == 2;
+  std::mt19937_64 engine(42);
+  std::uniform_real_distribution<double> step(0.5, 1.5);
+  std::vector<double> x(knots), y(knots);
+  for (std::size_t i = 1; i < knots; ++i)
+  {
+    x[i] = uniform ? static_cast<double>(i) * 0.1 : x[i - 1] + step(engine);
+    y[i] = step(engine);
+  }
+  std::uniform_real_distribution<double> point(x.front(), x.back());
+  std::vector<double> points(4096), out(points.size());
+  for (auto &p : points)
+  {
+    p = point(engine);
+  }
+  Foo foo;
+  const Spline spline = foo.spline(x, y);
+  state.SetLabel(pairwise ? "search + Foo::spline" : uniform ? "Spline uniform" : "Spline Eytzinger");
+
+  // Act
+  for (auto _ : state)
+  {
+    if (pairwise)
+    {
+      // Baseline: locate the interval, then interpolate its two knots with Foo::spline
+      for (std::size_t i = 0; i < points.size(); ++i)
+      {
+        const auto k = static_cast<std::size_t>(std::upper_bound(x.begin() + 1, x.end() - 1, points[i]) - x.begin());
+        out[i] = foo.spline(x[k - 1], y[k - 1], x[k], y[k], points[i]);
+      }
+    }
+    else
+    {
+      spline.evaluate(points, out);
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * points.size()));
+}
+BENCHMARK(BM_SplineEvaluate)->ArgsProduct({{16, 1024, 1 << 16, 1 << 20, 10000000}, {0, 1, 2}});
+
+static void BM_Fibonacci(benchmark::State &state)
+{
+  // Arrange
+  Foo foo;
+  auto n = static_cast<int>(state.range(0));
+
+  // Act
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(n);
+    benchmark::DoNotOptimize(foo.fibonacci(n));
+  }
+}
+BENCHMARK(BM_Fibonacci)->Arg(93)->Arg(1000000);
+
+// Baseline: the term-by-term loop fibonacci() used to run
+static void BM_FibonacciLoop(benchmark::State &state)
+{
+  // Arrange
+  const auto n = static_cast<int>(state.range(0));
+
+  // Act
+  for (auto _ : state)
+  {
+    unsigned long long a = 0;
+    unsigned long long b = 1;
+    for (int i = 0; i < n; ++i)
+    {
+      b = std::exchange(a, b) + b;
+      benchmark::DoNotOptimize(b);
+    }
+    benchmark::DoNotOptimize(a);
+  }
+}
+BENCHMARK(BM_FibonacciLoop)->Arg(93)->Arg(1000000);
+
+// Discards characters, so only the conversion itself is timed
+class NullBuffer : public std::streambuf
+{
+protected:
+  std::streamsize xsputn(const char *, std::streamsize count) override
+  {
+    return count;
+  }
+
+  int_type overflow(int_type c) override
+  {
+    return traits_type::not_eof(c);
+  }
+};
+
+static void BM_FibonacciBig(benchmark::State &state)
+{
+  // Arrange
+  Foo foo;
+  const auto n = static_cast<int>(state.range(0));
+
+  // Act
+  const PeakHeap heap;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(foo.fibonacci_big(n));
+  }
+  state.counters["peak_heap"] = heap.counter();
+}
+BENCHMARK(BM_FibonacciBig)->Arg(1000000)->Arg(10000000)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_FibonacciBigWriteDecimal(benchmark::State &state)
+{
+  // Arrange
+  Foo foo;
+  const BigInt value = foo.fibonacci_big(static_cast<int>(state.range(0)));
+  NullBuffer buffer;
+  std::ostream out(&buffer);
+
+  // Act
+  const PeakHeap heap;
+  for (auto _ : state)
+  {
+    value.write_decimal(out);
+  }
+  state.counters["peak_heap"] = heap.counter();
+}
+BENCHMARK(BM_FibonacciBigWriteDecimal)->Arg(1000000)->Arg(10000000)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// Each algorithm at the top level on balanced operands of 16 to 16384 limbs.
+// Where two curves cross is where the thresholds in big_int.cpp belong
+static void BM_BigIntMultiply(benchmark::State &state)
+{
+  // Arrange
+  static constexpr const char *names[] = {"automatic", "schoolbook", "karatsuba", "toom3", "ntt"};
+  const auto algorithm = static_cast<BigInt::Multiplication>(state.range(0));
+  const auto limbs = static_cast<std::size_t>(state.range(1));
+  const BigInt a = random_big_int(limbs, 1);
+  const BigInt b = random_big_int(limbs, 2);
+  state.SetLabel(names[state.range(0)]);
+
+  // Act
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(multiply(a, b, algorithm));
+  }
+}
+BENCHMARK(BM_BigIntMultiply)->ArgsProduct({{0, 1, 2, 3, 4}, benchmark::CreateRange(16, 16384, 2)});
+
+// Products and sums that stay below 2^128, where the inline limbs spare every allocation
+static void BM_BigIntSmall(benchmark::State &state)
+{
+  // Arrange
+  std::mt19937_64 engine(42);
+  std::vector<std::uint64_t> values(1024);
+  std::generate(values.begin(), values.end(), std::ref(engine));
+
+  // Act
+  for (auto _ : state)
+  {
+    BigInt sum;
+    for (std::size_t i = 0; i + 1 < values.size(); i += 2)
+    {
+      sum = BigInt(values[i] >> 2) * BigInt(values[i + 1] >> 2) + (sum >> 1);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * values.size() / 2));
+}
+BENCHMARK(BM_BigIntSmall);
+
+// The same chain in Int256, which needs no allocation and no carry loops
+static void BM_Int256Small(benchmark::State &state)
+{
+  // Arrange
+  std::mt19937_64 engine(42);
+  std::vector<std::uint64_t> values(1024);
+  std::generate(values.begin(), values.end(), std::ref(engine));
+
+  // Act
+  for (auto _ : state)
+  {
+    Int256 sum;
+    for (std::size_t i = 0; i + 1 < values.size(); i += 2)
+    {
+      sum = Int256(values[i] >> 2) * Int256(values[i + 1] >> 2) + (sum >> 1);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * values.size() / 2));
+}
+BENCHMARK(BM_Int256Small);
+
+// The largest exact 256-bit Fibonacci number and factorial, fixed width
+// against BigInt
+static void BM_Fibonacci256(benchmark::State &state)
+{
+  // Arrange
+  Foo foo;
+  auto n = 368;
+  const bool big = state.range(0) != 0;
+  state.SetLabel(big ? "fibonacci_big" : "fibonacci256");
+
+  // Act
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(n);
+    if (big)
+    {
+      benchmark::DoNotOptimize(foo.fibonacci_big(n));
+    }
+    else
+    {
+      benchmark::DoNotOptimize(foo.fibonacci256(n));
+    }
+  }
+}
+BENCHMARK(BM_Fibonacci256)->DenseRange(0, 1);
+
+static void BM_Factorial256(benchmark::State &state)
+{
+  // Arrange
+  Foo foo;
+  auto n = 57;
+  const bool big = state.range(0) != 0;
+  state.SetLabel(big ? "factorial_big" : "factorial256");
+
+  // Act
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(n);
+    if (big)
+    {
+      benchmark::DoNotOptimize(foo.factorial_big(n));
+    }
+    else
+    {
+      benchmark::DoNotOptimize(foo.factorial256(n));
+    }
+  }
+}
+BENCHMARK(BM_Factorial256)->DenseRange(0, 1);
+
+// A hash-sized prime, an even composite and the largest 64-bit prime
+static constexpr std::uint64_t fibonacci_moduli[] = {1000000007ULL, 1000000000ULL, 18446744073709551557ULL};
+
+static void BM_FibonacciMod(benchmark::State &state)
+{
+  // Arrange
+  Foo foo;
+  const std::uint64_t m = fibonacci_moduli[state.range(0)];
+  std::mt19937_64 engine(42);
+  std::vector<std::uint64_t> indices(1024);
+  for (auto &n : indices)
+  {
+    n = engine();
+  }
+  state.SetLabel(std::to_string(m));
+
+  // Act
+  std::size_t i = 0;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(foo.fibonacci_mod(indices[i++ % indices.size()], m));
+  }
+}
+BENCHMARK(BM_FibonacciMod)->DenseRange(0, 2);
+
+static void BM_FibonacciModBatch(benchmark::State &state)
+{
+  // Arrange
+  Foo foo;
+  const std::uint64_t m = fibonacci_moduli[state.range(0)];
+  std::mt19937_64 engine(42);
+  std::vector<std::uint64_t> indices(4096);
+  for (auto &n : indices)
+  {
+    n = engine();
+  }
+  std::vector<std::uint64_t> out(indices.size());
+  state.SetLabel(std::to_string(m));
+
+  // Act
+  for (auto _ : state)
+  {
+    foo.fibonacci_mod(indices, m, out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * indices.size()));
+}
+BENCHMARK(BM_FibonacciModBatch)->DenseRange(0, 2);
+
+// Baseline: fast doubling on the full index with a 128-bit division per product
+static void BM_FibonacciModDivision(benchmark::State &state)
+{
+  // Arrange
+  const std::uint64_t m = fibonacci_moduli[state.range(0)];
+  std::mt19937_64 engine(42);
+  std::vector<std::uint64_t> indices(4096);
+  for (auto &n : indices)
+  {
+    n = engine();
+  }
+  const auto mulmod = [m](std::uint64_t a, std::uint64_t b)
+  {
+    return static_cast<std::uint64_t>(static_cast<uint128_t>(a) * b % m);
+  };
+  state.SetLabel(std::to_string(m));
+
+  // Act
+  for (auto _ : state)
+  {
+    for (const auto n : indices)
+    {
+      std::uint64_t a = 0;
+      std::uint64_t b = 1;
+      for (int bit = 63; bit >= 0; --bit)
+      {
+        const std::uint64_t even = mulmod(a, (2 * static_cast<uint128_t>(b) + m - a) % m);
+        const std::uint64_t odd = static_cast<std::uint64_t>((static_cast<uint128_t>(mulmod(a, a)) + mulmod(b, b)) % m);
+        a = (n >> bit) & 1U ? odd : even;
+        b = (n >> bit) & 1U ? static_cast<std::uint64_t>((static_cast<uint128_t>(even) + odd) % m) : odd;
+      }
+      benchmark::DoNotOptimize(a);
+    }
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * indices.size()));
+}
+BENCHMARK(BM_FibonacciModDivision)->DenseRange(0, 2);
+
+// int max, 2^61 - 1 and the largest 64-bit prime each run every Miller-Rabin base
+static void BM_IsPrime(benchmark::State &state)
+{
+  static constexpr std::uint64_t primes[] = {2147483647ULL, 2305843009213693951ULL, 18446744073709551557ULL};
+
+  // Arrange
+  Foo foo;
+  const std::uint64_t n = primes[state.range(0)];
+  state.SetLabel(std::to_string(n));
+
+  // Act
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(foo.is_prime(n));
+  }
+}
+BENCHMARK(BM_IsPrime)->DenseRange(0, 2);
+
+// Random 32-bit candidates, the shape of an ID batch
+static void BM_IsPrimeBatch(benchmark::State &state)
+{
+  // Arrange
+  Foo foo;
+  std::mt19937 engine(42);
+  std::vector<std::uint32_t> values(static_cast<std::size_t>(state.range(0)));
+  std::generate(values.begin(), values.end(), [&] { return static_cast<std::uint32_t>(engine()); });
+  std::vector<std::uint64_t> mask((values.size() + 63) / 64);
+
+  // Act
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(foo.is_prime(values, mask));
+    benchmark::DoNotOptimize(mask.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_IsPrimeBatch)->Arg(1 << 16)->Arg(1 << 20);
+
+// Baseline: one scalar call per candidate
+static void BM_IsPrimeLoop(benchmark::State &state)
+{
+  // Arrange
+  Foo foo;
+  std::mt19937 engine(42);
+  std::vector<std::uint32_t> values(static_cast<std::size_t>(state.range(0)));
+  std::generate(values.begin(), values.end(), [&] { return static_cast<std::uint32_t>(engine()); });
+
+  // Act
+  for (auto _ : state)
+  {
+    std::size_t count = 0;
+    for (const auto value : values)
+    {
+      count += foo.is_prime(std::uint64_t{value}) ? 1 : 0;
+    }
+    benchmark::DoNotOptimize(count);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_IsPrimeLoop)->Arg(1 << 16)->Arg(1 << 20);
+
+// The same candidates answered from a table of the whole 32-bit domain, written once per run
+static void BM_PrimeTableIsPrime(benchmark::State &state)
+{
+  // Arrange
+  // The pid keeps concurrent bench runs from sharing one scratch table
+  static const std::string path = (std::filesystem::temp_directory_path() /
+                                   ("foo_bench_primes_" + std::to_string(::getpid()) + ".bin"))
+                                      .string();
+  // The mapping outlives the file, so the table stays usable once it is removed below
+  static const PrimeTable table = []
+  {
+    PrimeTable::write(path);
+    return PrimeTable(path);
+  }();
+  std::mt19937 engine(42);
+  std::vector<std::uint32_t> values(static_cast<std::size_t>(state.range(0)));
+  std::generate(values.begin(), values.end(), [&] { return static_cast<std::uint32_t>(engine()); });
+
+  // Act
+  for (auto _ : state)
+  {
+    std::size_t count = 0;
+    for (const auto value : values)
+    {
+      count += table.is_prime(value) ? 1 : 0;
+    }
+    benchmark::DoNotOptimize(count);
+  }
+
+  std::filesystem::remove(path);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PrimeTableIsPrime)->Arg(1 << 16)->Arg(1 << 20);
+
+// Balanced semiprimes of 40, 52 and 64 bits, the hardest inputs for rho of their size
+static void BM_Factorize(benchmark::State &state)
+{
+  static constexpr std::uint64_t semiprimes[] = {1048573ULL * 1048571ULL, 67108859ULL * 67108837ULL,
+                                                 4294967291ULL * 4294967279ULL};
+
+  // Arrange
+  Foo foo;
+  const std::uint64_t n = semiprimes[state.range(0)];
+  state.SetLabel(std::to_string(n));
+
+  // Act
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(foo.factorize(n));
+  }
+}
+BENCHMARK(BM_Factorize)->DenseRange(0, 2)->Unit(benchmark::kMicrosecond);
+
+// Random 64-bit integers, most of which split off small factors early
+static void BM_FactorizeBatch(benchmark::State &state)
+{
+  // Arrange
+  Foo foo;
+  std::mt19937_64 engine(42);
+  std::vector<std::uint64_t> values(static_cast<std::size_t>(state.range(0)));
+  std::generate(values.begin(), values.end(), [&] { return engine() | 1; });
+  const auto threads = static_cast<unsigned>(state.range(1));
+
+  // Act
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(foo.factorize(values, threads));
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FactorizeBatch)->Args({4096, 1})->Args({4096, 0})->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// Baseline: trial division by every odd integer up to the square root, on the 40-bit semiprime
+static void BM_FactorizeTrialDivision(benchmark::State &state)
+{
+  // Arrange
+  const std::uint64_t n = 1048573ULL * 1048571ULL;
+
+  // Act
+  for (auto _ : state)
+  {
+    std::vector<std::uint64_t> factors;
+    std::uint64_t m = n;
+    for (std::uint64_t d = 3; d * d <= m; d += 2)
+    {
+      for (; m % d == 0; m /= d)
+      {
+        factors.push_back(d);
+      }
+    }
+    if (m > 1)
+    {
+      factors.push_back(m);
+    }
+    benchmark::DoNotOptimize(factors.data());
+  }
+}
+BENCHMARK(BM_FactorizeTrialDivision)->Unit(benchmark::kMicrosecond);
+
+static void BM_CountPrimes(benchmark::State &state)
+{
+  // Arrange
+  Foo foo;
+  const auto last = static_cast<std::uint64_t>(state.range(0));
+
+  // Act
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(foo.count_primes(0, last));
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CountPrimes)->Arg(1000000)->Arg(100000000)->Arg(1000000000)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// A window of 10^8 integers starting at 10^12, streamed without materializing it
+static void BM_ForEachPrime(benchmark::State &state)
+{
+  // Arrange
+  Foo foo;
+  const std::uint64_t first = 1000000000000ULL;
+
+  // Act
+  for (auto _ : state)
+  {
+    std::uint64_t sum = 0;
+    foo.for_each_prime(first, first + 100000000,
+                       [&sum](std::span<const std::uint64_t> run)
+                       {
+                         for (const auto p : run)
+                         {
+                           sum += p;
+                         }
+                       });
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * 100000000);
+}
+BENCHMARK(BM_ForEachPrime)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_PrimePi(benchmark::State &state)
+{
+  // Arrange
+  Foo foo;
+  const auto x = static_cast<std::uint64_t>(state.range(0));
+  const auto threads = static_cast<unsigned>(state.range(1));
+
+  // Act
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(foo.prime_pi(x, threads));
+  }
+}
+BENCHMARK(BM_PrimePi)
+    ->ArgsProduct({{1000000, 100000000, 1000000000, 1000000000000}, {1, 0}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// Baseline: one is_prime call per integer
+static void BM_CountPrimesLoop(benchmark::State &state)
+{
+  // Arrange
+  Foo foo;
+  const auto last = static_cast<std::uint64_t>(state.range(0));
+
+  // Act
+  for (auto _ : state)
+  {
+    std::uint64_t count = 0;
+    for (std::uint64_t n = 0; n < last; ++n)
+    {
+      count += foo.is_prime(n) ? 1 : 0;
+    }
+    benchmark::DoNotOptimize(count);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CountPrimesLoop)->Arg(1000000)->Unit(benchmark::kMillisecond);
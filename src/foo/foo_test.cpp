@@ -1,10 +1,20 @@
 #include <gtest/gtest.h>
 #include <nlohmann/json.hpp>
 
+#include <algorithm>
 #include <climits>
+#include <cstdint>
 #include <filesystem>
 #include <fstream>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <span>
+#include <stdexcept>
 #include <string>
+#include <thread>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -129,7 +139,7 @@ TEST(FooTest, Multiply)
       {"multiply by zero", /* in */ {5, 0}, /* want */ {0}},
       {"boundary: int max * 1", /* in */ {INT_MAX, 1}, /* want */ {INT_MAX}},
       {"boundary: int min * 1", /* in */ {INT_MIN, 1}, /* want */ {INT_MIN}},
-      {"overflow: int max * 2", /* in */ {INT_MAX, 2}, /* want */ {INT_MIN}}, // This tests overflow
+      {"overflow: int max * 2", /* in */ {INT_MAX, 2}, /* want */ {-2}}, // Wraps to the low 32 bits
   };
 
   for (const auto &tc : tests)
@@ -147,7 +157,7 @@ TEST(FooTest, Multiply)
   }
 }
 
-TEST(FooTest, Divide)
+TEST(FooTest, MultiplyBig)
 {
   // In-Got-Want
   struct Tests
@@ -156,26 +166,27 @@ TEST(FooTest, Divide)
 
     struct In
     {
-      int numerator;
-      int denominator;
+      BigInt a;
+      BigInt b;
     } in;
 
     struct Want
     {
-      double result;
-      bool throws_exception;
+      BigInt result;
     } want;
   };
 
+  // (2^n - 1)(2^n - 1) = 2^2n - 2^(n+1) + 1 exercises every carry
+  const auto mersenne = [](std::size_t n) { return (BigInt(1) << n) - 1U; };
+  const auto mersenne_square = [](std::size_t n) { return (BigInt(1) << (2 * n)) - (BigInt(1) << (n + 1)) + 1U; };
+
   // Table-Driven Testing
   const std::vector<Tests> tests = {
-      {"positive division", /* in */ {10, 2}, /* want */ {5.0, false}},
-      {"negative division", /* in */ {-10, 2}, /* want */ {-5.0, false}},
-      {"mixed sign division", /* in */ {10, -2}, /* want */ {-5.0, false}},
-      {"zero numerator", /* in */ {0, 5}, /* want */ {0.0, false}},
-      {"division by one", /* in */ {10, 1}, /* want */ {10.0, false}},
-      {"division with remainder", /* in */ {7, 2}, /* want */ {3.0, false}},
-      {"division by zero", /* in */ {10, 0}, /* want */ {0.0, true}},
+      {"zero factor", /* in */ {0U, mersenne(640)}, /* want */ {0U}},
+      {"single limbs", /* in */ {~std::uint64_t{0}, ~std::uint64_t{0}}, /* want */ {mersenne_square(64)}},
+      {"Toom-3 sized", /* in */ {mersenne(64 * 300), mersenne(64 * 300)}, /* want */ {mersenne_square(64 * 300)}},
+      {"NTT sized", /* in */ {mersenne(64 * 3000), mersenne(64 * 3000)}, /* want */ {mersenne_square(64 * 3000)}},
+      {"unbalanced powers of two", /* in */ {BigInt(1) << 100000, BigInt(3) << 70}, /* want */ {BigInt(3) << 100070}},
   };
 
   for (const auto &tc : tests)
@@ -185,22 +196,16 @@ TEST(FooTest, Divide)
     // Arrange
     Foo foo;
 
-    // Act & Assert
-    if (tc.want.throws_exception)
-    {
-      EXPECT_THROW(foo.divide(tc.in.numerator, tc.in.denominator), std::invalid_argument);
-    }
-    else
-    {
-      auto got = foo.divide(tc.in.numerator, tc.in.denominator);
-      EXPECT_DOUBLE_EQ(got, tc.want.result);
-    }
+    // Act
+    auto got = foo.multiply(tc.in.a, tc.in.b);
+
+    // Assert
+    EXPECT_EQ(got, tc.want.result);
   }
 }
 
-class FooFixture : public ::testing::Test
+TEST(FooTest, Arithmetic128)
 {
-protected:
   // In-Got-Want
   struct Tests
   {
@@ -208,50 +213,28 @@ protected:
 
     struct In
     {
-      std::string text;
+      uint128_t a;
+      uint128_t b;
     } in;
 
     struct Want
     {
-      std::string result;
+      uint128_t sum;
+      uint128_t difference;
+      uint128_t product;
     } want;
   };
 
-  // Data-Driven Testing
-  std::vector<Tests> tests;
-
-  void SetUp() override
-  {
-    // Load JSON
-    std::string filename = "foo_test.json";
-    std::filesystem::path filepath = std::filesystem::path(__FILE__).parent_path() / filename;
-    std::ifstream file(filepath);
-    ASSERT_TRUE(file.good()) << "Failed to open JSON: " << filepath.string();
-
-    // Parse JSON
-    nlohmann::json data = nlohmann::json::parse(file);
-    for (const auto &row : data["foo::greet"])
-    {
-      Tests tmp;
-      tmp.label = row.at("label").get<std::string>();
-      tmp.in.text = row.at("in").at("text").get<std::string>();
-      tmp.want.result = row.at("want").at("result").get<std::string>();
-
-      tests.push_back(std::move(tmp));
-    }
-
-    ASSERT_FALSE(tests.empty()) << "Failed to parse JSON: " << filepath.string();
-  }
+  const uint128_t max = ~uint128_t{0};
 
-  void TearDown() override
-  {
-    // Cleanup
-    tests.clear();
-  }
-};
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"operand past 64 bits", /* in */ {uint128_t{1} << 100, 3}, /* want */ {(uint128_t{1} << 100) + 3, (uint128_t{1} << 100) - 3, uint128_t{3} << 100}},
+      {"zero minus one", /* in */ {0, 1}, /* want */ {1, max, 0}},
+      {"boundary: sum wraps to zero", /* in */ {max, 1}, /* want */ {0, max - 1, max}},
+      {"boundary: product wraps to zero", /* in */ {uint128_t{1} << 64, uint128_t{1} << 64}, /* want */ {uint128_t{1} << 65, 0, 0}},
+  };
 
-TEST_F(FooFixture, Greet)
-{
   for (const auto &tc : tests)
   {
     SCOPED_TRACE(tc.label);
@@ -259,15 +242,53 @@ TEST_F(FooFixture, Greet)
     // Arrange
     Foo foo;
 
-    // Act
-    auto got = foo.greet(tc.in.text);
-
-    // Assert
-    EXPECT_EQ(got, tc.want.result);
+    // Act & Assert
+    // Widened to Int256, which gtest can print
+    EXPECT_EQ(Int256(foo.add(tc.in.a, tc.in.b)), Int256(tc.want.sum));
+    EXPECT_EQ(Int256(foo.subtract(tc.in.a, tc.in.b)), Int256(tc.want.difference));
+    EXPECT_EQ(Int256(foo.multiply(tc.in.a, tc.in.b)), Int256(tc.want.product));
   }
 }
 
-TEST(FooTest, IsEven)
+namespace
+{
+
+  // Whether Foo::add, subtract and multiply accept operands of types A and B
+  template <typename A, typename B>
+  concept FooArithmetic = requires(const Foo &foo, A a, B b) {
+    foo.add(a, b);
+    foo.subtract(a, b);
+    foo.multiply(a, b);
+  };
+
+} // namespace
+
+TEST(FooTest, Arithmetic128Overloads)
+{
+  // Arrange
+  Foo foo;
+
+  // Act & Assert
+  // A uint128_t operand selects the 128-bit overload, even beside a built-in integer
+  static_assert(std::is_same_v<decltype(foo.multiply(uint128_t{1} << 100, uint128_t{3})), uint128_t>);
+  static_assert(std::is_same_v<decltype(foo.multiply(uint128_t{1} << 100, 3)), uint128_t>);
+  static_assert(std::is_same_v<decltype(foo.add(7UL, uint128_t{1})), uint128_t>);
+  // Calls without one still resolve to the int overloads
+  static_assert(std::is_same_v<decltype(foo.add(7, 8)), int>);
+  static_assert(std::is_same_v<decltype(foo.add(7U, 8U)), int>);
+  static_assert(std::is_same_v<decltype(foo.multiply(7L, 8L)), int>);
+  // bool and character operands are rejected instead of promoted to int
+  static_assert(FooArithmetic<std::int8_t, std::uint8_t>);
+  static_assert(!FooArithmetic<bool, char>);
+  static_assert(!FooArithmetic<int, bool>);
+  static_assert(!FooArithmetic<uint128_t, bool>);
+  static_assert(!FooArithmetic<char8_t, uint128_t>);
+  static_assert(!FooArithmetic<Int256, wchar_t>);
+  EXPECT_EQ(Int256(foo.multiply(uint128_t{1} << 100, 3)), Int256(uint128_t{3} << 100));
+  EXPECT_EQ(Int256(foo.subtract(uint128_t{5}, -1)), Int256(6));
+}
+
+TEST(FooTest, AddBatch)
 {
   // In-Got-Want
   struct Tests
@@ -276,24 +297,29 @@ TEST(FooTest, IsEven)
 
     struct In
     {
-      int n;
+      std::vector<int> a;
+      std::vector<int> b;
+      std::size_t out_size;
     } in;
 
     struct Want
     {
-      bool result;
+      std::vector<int> result;
+      bool throws_exception;
     } want;
   };
 
   // Table-Driven Testing
   const std::vector<Tests> tests = {
-      {"positive even", /* in */ {4}, /* want */ {true}},
-      {"positive odd", /* in */ {3}, /* want */ {false}},
-      {"negative even", /* in */ {-4}, /* want */ {true}},
-      {"negative odd", /* in */ {-3}, /* want */ {false}},
-      {"zero", /* in */ {0}, /* want */ {true}},
-      {"boundary: int max", /* in */ {INT_MAX}, /* want */ {false}},
-      {"boundary: int min", /* in */ {INT_MIN}, /* want */ {true}},
+      {"empty spans", /* in */ {{}, {}, 0}, /* want */ {{}, false}},
+      {"single lane", /* in */ {{2}, {3}, 1}, /* want */ {{5}, false}},
+      {"scalar tail", /* in */ {{1, 2, 3, 4, 5, 6, 7}, {7, 6, 5, 4, 3, 2, 1}, 7}, /* want */ {{8, 8, 8, 8, 8, 8, 8}, false}},
+      {"vector body and tail",
+       /* in */ {{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}, {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1}, 17},
+       /* want */ {{-1, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15}, false}},
+      {"overflow: int max + 1", /* in */ {{INT_MAX, INT_MIN}, {1, -1}, 2}, /* want */ {{INT_MIN, INT_MAX}, false}},
+      {"mismatched inputs", /* in */ {{1, 2}, {1}, 2}, /* want */ {{}, true}},
+      {"mismatched output", /* in */ {{1, 2}, {1, 2}, 1}, /* want */ {{}, true}},
   };
 
   for (const auto &tc : tests)
@@ -302,16 +328,22 @@ TEST(FooTest, IsEven)
 
     // Arrange
     Foo foo;
+    std::vector<int> got(tc.in.out_size);
 
-    // Act
-    auto got = foo.is_even(tc.in.n);
-
-    // Assert
-    EXPECT_EQ(got, tc.want.result);
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(foo.add(tc.in.a, tc.in.b, got), std::invalid_argument);
+    }
+    else
+    {
+      foo.add(tc.in.a, tc.in.b, got);
+      EXPECT_EQ(got, tc.want.result);
+    }
   }
 }
 
-TEST(FooTest, Reverse)
+TEST(FooTest, SubtractBatch)
 {
   // In-Got-Want
   struct Tests
@@ -320,23 +352,27 @@ TEST(FooTest, Reverse)
 
     struct In
     {
-      std::string text;
+      std::vector<int> a;
+      std::vector<int> b;
+      std::size_t out_size;
     } in;
 
     struct Want
     {
-      std::string result;
+      std::vector<int> result;
+      bool throws_exception;
     } want;
   };
 
   // Table-Driven Testing
   const std::vector<Tests> tests = {
-      {"normal string", /* in */ {"hello"}, /* want */ {"olleh"}},
-      {"empty string", /* in */ {""}, /* want */ {""}},
-      {"single character", /* in */ {"a"}, /* want */ {"a"}},
-      {"palindrome", /* in */ {"racecar"}, /* want */ {"racecar"}},
-      {"spaces", /* in */ {"hello test"}, /* want */ {"tset olleh"}},
-      {"special characters", /* in */ {"!@#$%"}, /* want */ {"%$#@!"}},
+      {"empty spans", /* in */ {{}, {}, 0}, /* want */ {{}, false}},
+      {"single lane", /* in */ {{5}, {3}, 1}, /* want */ {{2}, false}},
+      {"vector body and tail",
+       /* in */ {{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}, {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, 17},
+       /* want */ {{-1, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15}, false}},
+      {"overflow: int min - 1", /* in */ {{INT_MIN, INT_MAX}, {1, -1}, 2}, /* want */ {{INT_MAX, INT_MIN}, false}},
+      {"mismatched inputs", /* in */ {{1, 2}, {1}, 2}, /* want */ {{}, true}},
   };
 
   for (const auto &tc : tests)
@@ -345,16 +381,22 @@ TEST(FooTest, Reverse)
 
     // Arrange
     Foo foo;
+    std::vector<int> got(tc.in.out_size);
 
-    // Act
-    auto got = foo.reverse(tc.in.text);
-
-    // Assert
-    EXPECT_EQ(got, tc.want.result);
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(foo.subtract(tc.in.a, tc.in.b, got), std::invalid_argument);
+    }
+    else
+    {
+      foo.subtract(tc.in.a, tc.in.b, got);
+      EXPECT_EQ(got, tc.want.result);
+    }
   }
 }
 
-TEST(FooTest, Factorial)
+TEST(FooTest, MultiplyBatch)
 {
   // In-Got-Want
   struct Tests
@@ -363,25 +405,27 @@ TEST(FooTest, Factorial)
 
     struct In
     {
-      int n;
+      std::vector<int> a;
+      std::vector<int> b;
+      std::size_t out_size;
     } in;
 
     struct Want
     {
-      unsigned long long result;
+      std::vector<int> result;
       bool throws_exception;
     } want;
   };
 
   // Table-Driven Testing
   const std::vector<Tests> tests = {
-      {"factorial of zero", /* in */ {0}, /* want */ {1, false}},
-      {"factorial of one", /* in */ {1}, /* want */ {1, false}},
-      {"factorial of two", /* in */ {2}, /* want */ {2, false}},
-      {"factorial of five", /* in */ {5}, /* want */ {120, false}},
-      {"factorial of ten", /* in */ {10}, /* want */ {3628800, false}},
-      {"negative input", /* in */ {-1}, /* want */ {0, true}},
-      {"boundary: large number", /* in */ {20}, /* want */ {2432902008176640000ULL, false}},
+      {"empty spans", /* in */ {{}, {}, 0}, /* want */ {{}, false}},
+      {"single lane", /* in */ {{2}, {3}, 1}, /* want */ {{6}, false}},
+      {"vector body and tail",
+       /* in */ {{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}, {-2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2}, 17},
+       /* want */ {{0, -2, -4, -6, -8, -10, -12, -14, -16, -18, -20, -22, -24, -26, -28, -30, -32}, false}},
+      {"overflow: low 32 bits", /* in */ {{INT_MAX, INT_MIN, 65536}, {2, -1, 65536}, 3}, /* want */ {{-2, INT_MIN, 0}, false}},
+      {"mismatched inputs", /* in */ {{1, 2}, {1}, 2}, /* want */ {{}, true}},
   };
 
   for (const auto &tc : tests)
@@ -390,21 +434,22 @@ TEST(FooTest, Factorial)
 
     // Arrange
     Foo foo;
+    std::vector<int> got(tc.in.out_size);
 
     // Act & Assert
     if (tc.want.throws_exception)
     {
-      EXPECT_THROW(foo.factorial(tc.in.n), std::invalid_argument);
+      EXPECT_THROW(foo.multiply(tc.in.a, tc.in.b, got), std::invalid_argument);
     }
     else
     {
-      auto got = foo.factorial(tc.in.n);
+      foo.multiply(tc.in.a, tc.in.b, got);
       EXPECT_EQ(got, tc.want.result);
     }
   }
 }
 
-TEST(FooTest, Spline)
+TEST(FooTest, CheckedAdd)
 {
   // In-Got-Want
   struct Tests
@@ -413,28 +458,23 @@ TEST(FooTest, Spline)
 
     struct In
     {
-      double x0;
-      double y0;
-      double x1;
-      double y1;
-      double x;
+      int a;
+      int b;
     } in;
 
     struct Want
     {
-      double result;
-      bool throws_exception;
+      int result;
+      bool overflowed;
     } want;
   };
 
   // Table-Driven Testing
   const std::vector<Tests> tests = {
-      {"x at x0", /* in */ {0, 0, 10, 20, 0}, /* want */ {0.0, false}},
-      {"x at x1", /* in */ {0, 0, 10, 20, 10}, /* want */ {20.0, false}},
-      {"negative coordinates", /* in */ {-5, -10, 5, 10, 0}, /* want */ {0.0, false}},
-      {"x between points", /* in */ {1, 2, 3, 6, 2}, /* want */ {4.0, false}},
-      {"same x0 and x1", /* in */ {5, 10, 5, 15, 5}, /* want */ {0.0, true}},
-      {"x beyond range", /* in */ {0, 0, 10, 20, 15}, /* want */ {30.0, false}},
+      {"no overflow", /* in */ {2, 3}, /* want */ {5, false}},
+      {"boundary: int max + 0", /* in */ {INT_MAX, 0}, /* want */ {INT_MAX, false}},
+      {"overflow: int max + 1", /* in */ {INT_MAX, 1}, /* want */ {INT_MIN, true}},
+      {"overflow: int min + -1", /* in */ {INT_MIN, -1}, /* want */ {INT_MAX, true}},
   };
 
   for (const auto &tc : tests)
@@ -443,21 +483,18 @@ TEST(FooTest, Spline)
 
     // Arrange
     Foo foo;
+    int got = 0;
 
-    // Act & Assert
-    if (tc.want.throws_exception)
-    {
-      EXPECT_THROW(foo.spline(tc.in.x0, tc.in.y0, tc.in.x1, tc.in.y1, tc.in.x), std::invalid_argument);
-    }
-    else
-    {
-      auto got = foo.spline(tc.in.x0, tc.in.y0, tc.in.x1, tc.in.y1, tc.in.x);
-      EXPECT_DOUBLE_EQ(got, tc.want.result);
-    }
+    // Act
+    auto overflowed = foo.checked_add(tc.in.a, tc.in.b, got);
+
+    // Assert
+    EXPECT_EQ(got, tc.want.result);
+    EXPECT_EQ(overflowed, tc.want.overflowed);
   }
 }
 
-TEST(FooTest, Fibonacci)
+TEST(FooTest, CheckedAddBatch)
 {
   // In-Got-Want
   struct Tests
@@ -466,28 +503,28 @@ TEST(FooTest, Fibonacci)
 
     struct In
     {
-      int n;
+      std::vector<int> a;
+      std::vector<int> b;
+      std::size_t mask_size;
     } in;
 
     struct Want
     {
-      unsigned long long result;
+      std::vector<int> result;
+      std::vector<std::uint64_t> overflow;
+      std::size_t count;
       bool throws_exception;
     } want;
   };
 
   // Table-Driven Testing
   const std::vector<Tests> tests = {
-      {"fibonacci of zero", /* in */ {0}, /* want */ {0, false}},
-      {"fibonacci of one", /* in */ {1}, /* want */ {1, false}},
-      {"fibonacci of two", /* in */ {2}, /* want */ {1, false}},
-      {"fibonacci of three", /* in */ {3}, /* want */ {2, false}},
-      {"fibonacci of four", /* in */ {4}, /* want */ {3, false}},
-      {"fibonacci of five", /* in */ {5}, /* want */ {5, false}},
-      {"fibonacci of ten", /* in */ {10}, /* want */ {55, false}},
-      {"fibonacci of fifteen", /* in */ {15}, /* want */ {610, false}},
-      {"negative input", /* in */ {-1}, /* want */ {0, true}},
-      {"boundary: large number", /* in */ {50}, /* want */ {12586269025ULL, false}},
+      {"empty spans", /* in */ {{}, {}, 0}, /* want */ {{}, {}, 0, false}},
+      {"vector body and tail",
+       /* in */ {{INT_MAX, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, INT_MAX}, {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, 1},
+       /* want */ {{INT_MIN, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, INT_MIN}, {0x10001}, 2, false}},
+      {"mismatched inputs", /* in */ {{1, 2}, {1}, 1}, /* want */ {{}, {}, 0, true}},
+      {"mask too small", /* in */ {{1, 2}, {1, 2}, 0}, /* want */ {{}, {}, 0, true}},
   };
 
   for (const auto &tc : tests)
@@ -496,21 +533,25 @@ TEST(FooTest, Fibonacci)
 
     // Arrange
     Foo foo;
+    std::vector<int> got(tc.in.a.size());
+    std::vector<std::uint64_t> overflow(tc.in.mask_size, ~std::uint64_t{0});
 
     // Act & Assert
     if (tc.want.throws_exception)
     {
-      EXPECT_THROW(foo.fibonacci(tc.in.n), std::invalid_argument);
+      EXPECT_THROW(foo.checked_add(tc.in.a, tc.in.b, got, overflow), std::invalid_argument);
     }
     else
     {
-      auto got = foo.fibonacci(tc.in.n);
+      auto count = foo.checked_add(tc.in.a, tc.in.b, got, overflow);
       EXPECT_EQ(got, tc.want.result);
+      EXPECT_EQ(overflow, tc.want.overflow);
+      EXPECT_EQ(count, tc.want.count);
     }
   }
 }
 
-TEST(FooTest, IsPrime)
+TEST(FooTest, SaturatingAdd)
 {
   // In-Got-Want
   struct Tests
@@ -519,29 +560,21 @@ TEST(FooTest, IsPrime)
 
     struct In
     {
-      int n;
+      int a;
+      int b;
     } in;
 
     struct Want
     {
-      bool result;
+      int result;
     } want;
   };
 
   // Table-Driven Testing
   const std::vector<Tests> tests = {
-      {"prime number 2", /* in */ {2}, /* want */ {true}},
-      {"prime number 3", /* in */ {3}, /* want */ {true}},
-      {"prime number 11", /* in */ {11}, /* want */ {true}},
-      {"prime number 17", /* in */ {17}, /* want */ {true}},
-      {"non-prime 1", /* in */ {1}, /* want */ {false}},
-      {"non-prime 4", /* in */ {4}, /* want */ {false}},
-      {"non-prime 6", /* in */ {6}, /* want */ {false}},
-      {"non-prime 9", /* in */ {9}, /* want */ {false}},
-      {"negative number", /* in */ {-5}, /* want */ {false}},
-      {"large prime 97", /* in */ {97}, /* want */ {true}},
-      {"large non-prime 100", /* in */ {100}, /* want */ {false}},
-      {"large prime 997", /* in */ {997}, /* want */ {true}},
+      {"no overflow", /* in */ {2, 3}, /* want */ {5}},
+      {"overflow: int max + 1", /* in */ {INT_MAX, 1}, /* want */ {INT_MAX}},
+      {"overflow: int min + -1", /* in */ {INT_MIN, -1}, /* want */ {INT_MIN}},
   };
 
   for (const auto &tc : tests)
@@ -552,14 +585,14 @@ TEST(FooTest, IsPrime)
     Foo foo;
 
     // Act
-    auto got = foo.is_prime(tc.in.n);
+    auto got = foo.saturating_add(tc.in.a, tc.in.b);
 
     // Assert
     EXPECT_EQ(got, tc.want.result);
   }
 }
 
-TEST(FooTest, Greet)
+TEST(FooTest, SaturatingAddBatch)
 {
   // In-Got-Want
   struct Tests
@@ -568,21 +601,22 @@ TEST(FooTest, Greet)
 
     struct In
     {
-      std::string text;
+      std::vector<int> a;
+      std::vector<int> b;
     } in;
 
     struct Want
     {
-      std::string result;
+      std::vector<int> result;
     } want;
   };
 
   // Table-Driven Testing
   const std::vector<Tests> tests = {
-      {"empty string", /* in */ {""}, /* want */ {"Hello, !"}},
-      {"single word", /* in */ {"World"}, /* want */ {"Hello, World!"}},
-      {"multiple words", /* in */ {"C++ Developer"}, /* want */ {"Hello, C++ Developer!"}},
-      {"with special characters", /* in */ {"Hello, World!"}, /* want */ {"Hello, Hello, World!!"}},
+      {"empty spans", /* in */ {{}, {}}, /* want */ {{}}},
+      {"vector body and tail",
+       /* in */ {{INT_MAX, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, INT_MAX}, {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}},
+       /* want */ {{INT_MAX, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, INT_MAX}}},
   };
 
   for (const auto &tc : tests)
@@ -591,16 +625,17 @@ TEST(FooTest, Greet)
 
     // Arrange
     Foo foo;
+    std::vector<int> got(tc.in.a.size());
 
     // Act
-    auto got = foo.greet(tc.in.text);
+    foo.saturating_add(tc.in.a, tc.in.b, got);
 
     // Assert
     EXPECT_EQ(got, tc.want.result);
   }
 }
 
-TEST(FooTest, FindMax)
+TEST(FooTest, CheckedSubtract)
 {
   // In-Got-Want
   struct Tests
@@ -609,24 +644,23 @@ TEST(FooTest, FindMax)
 
     struct In
     {
-      std::vector<int> vec;
+      int a;
+      int b;
     } in;
 
     struct Want
     {
       int result;
-      bool throws_exception;
+      bool overflowed;
     } want;
   };
 
   // Table-Driven Testing
   const std::vector<Tests> tests = {
-      {"single element", /* in */ {{5}}, /* want */ {5, false}},
-      {"positive numbers", /* in */ {{1, 3, 2, 5, 4}}, /* want */ {5, false}},
-      {"negative numbers", /* in */ {{-5, -3, -8, -1}}, /* want */ {-1, false}},
-      {"mixed numbers", /* in */ {{-2, 0, 3, -1, 2}}, /* want */ {3, false}},
-      {"duplicates", /* in */ {{2, 2, 2}}, /* want */ {2, false}},
-      {"empty vector", /* in */ {{}}, /* want */ {0, true}},
+      {"no overflow", /* in */ {5, 3}, /* want */ {2, false}},
+      {"boundary: -1 - int min", /* in */ {-1, INT_MIN}, /* want */ {INT_MAX, false}},
+      {"overflow: int min - 1", /* in */ {INT_MIN, 1}, /* want */ {INT_MAX, true}},
+      {"overflow: 0 - int min", /* in */ {0, INT_MIN}, /* want */ {INT_MIN, true}},
   };
 
   for (const auto &tc : tests)
@@ -635,16 +669,2678 @@ TEST(FooTest, FindMax)
 
     // Arrange
     Foo foo;
+    int got = 0;
 
-    // Act & Assert
-    if (tc.want.throws_exception)
+    // Act
+    auto overflowed = foo.checked_subtract(tc.in.a, tc.in.b, got);
+
+    // Assert
+    EXPECT_EQ(got, tc.want.result);
+    EXPECT_EQ(overflowed, tc.want.overflowed);
+  }
+}
+
+TEST(FooTest, CheckedSubtractBatch)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
     {
-      EXPECT_THROW(foo.find_max(tc.in.vec), std::invalid_argument);
-    }
-    else
+      std::vector<int> a;
+      std::vector<int> b;
+      std::size_t mask_size;
+    } in;
+
+    struct Want
     {
-      auto got = foo.find_max(tc.in.vec);
-      EXPECT_EQ(got, tc.want.result);
+      std::vector<int> result;
+      std::vector<std::uint64_t> overflow;
+      std::size_t count;
+      bool throws_exception;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"empty spans", /* in */ {{}, {}, 0}, /* want */ {{}, {}, 0, false}},
+      {"vector body and tail",
+       /* in */ {{INT_MIN, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 0}, {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, INT_MIN}, 1},
+       /* want */ {{INT_MAX, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, INT_MIN}, {0x10001}, 2, false}},
+      {"mismatched inputs", /* in */ {{1, 2}, {1}, 1}, /* want */ {{}, {}, 0, true}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+    std::vector<int> got(tc.in.a.size());
+    std::vector<std::uint64_t> overflow(tc.in.mask_size, ~std::uint64_t{0});
+
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(foo.checked_subtract(tc.in.a, tc.in.b, got, overflow), std::invalid_argument);
+    }
+    else
+    {
+      auto count = foo.checked_subtract(tc.in.a, tc.in.b, got, overflow);
+      EXPECT_EQ(got, tc.want.result);
+      EXPECT_EQ(overflow, tc.want.overflow);
+      EXPECT_EQ(count, tc.want.count);
+    }
+  }
+}
+
+TEST(FooTest, SaturatingSubtract)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      int a;
+      int b;
+    } in;
+
+    struct Want
+    {
+      int result;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"no overflow", /* in */ {5, 3}, /* want */ {2}},
+      {"overflow: int min - 1", /* in */ {INT_MIN, 1}, /* want */ {INT_MIN}},
+      {"overflow: 0 - int min", /* in */ {0, INT_MIN}, /* want */ {INT_MAX}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+
+    // Act
+    auto got = foo.saturating_subtract(tc.in.a, tc.in.b);
+
+    // Assert
+    EXPECT_EQ(got, tc.want.result);
+  }
+}
+
+TEST(FooTest, SaturatingSubtractBatch)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::vector<int> a;
+      std::vector<int> b;
+    } in;
+
+    struct Want
+    {
+      std::vector<int> result;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"empty spans", /* in */ {{}, {}}, /* want */ {{}}},
+      {"vector body and tail",
+       /* in */ {{INT_MIN, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 0}, {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, INT_MIN}},
+       /* want */ {{INT_MIN, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, INT_MAX}}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+    std::vector<int> got(tc.in.a.size());
+
+    // Act
+    foo.saturating_subtract(tc.in.a, tc.in.b, got);
+
+    // Assert
+    EXPECT_EQ(got, tc.want.result);
+  }
+}
+
+TEST(FooTest, CheckedMultiply)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      int a;
+      int b;
+    } in;
+
+    struct Want
+    {
+      int result;
+      bool overflowed;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"no overflow", /* in */ {-4, 5}, /* want */ {-20, false}},
+      {"boundary: int min * 1", /* in */ {INT_MIN, 1}, /* want */ {INT_MIN, false}},
+      {"overflow: int max * 2", /* in */ {INT_MAX, 2}, /* want */ {-2, true}},
+      {"overflow: int min * -1", /* in */ {INT_MIN, -1}, /* want */ {INT_MIN, true}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+    int got = 0;
+
+    // Act
+    auto overflowed = foo.checked_multiply(tc.in.a, tc.in.b, got);
+
+    // Assert
+    EXPECT_EQ(got, tc.want.result);
+    EXPECT_EQ(overflowed, tc.want.overflowed);
+  }
+}
+
+TEST(FooTest, CheckedMultiplyBatch)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::vector<int> a;
+      std::vector<int> b;
+      std::size_t mask_size;
+    } in;
+
+    struct Want
+    {
+      std::vector<int> result;
+      std::vector<std::uint64_t> overflow;
+      std::size_t count;
+      bool throws_exception;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"empty spans", /* in */ {{}, {}, 0}, /* want */ {{}, {}, 0, false}},
+      {"vector body and tail",
+       /* in */ {{65536, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, INT_MIN}, {65536, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, -1}, 1},
+       /* want */ {{0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, INT_MIN}, {0x10001}, 2, false}},
+      {"mismatched inputs", /* in */ {{1, 2}, {1}, 1}, /* want */ {{}, {}, 0, true}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+    std::vector<int> got(tc.in.a.size());
+    std::vector<std::uint64_t> overflow(tc.in.mask_size, ~std::uint64_t{0});
+
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(foo.checked_multiply(tc.in.a, tc.in.b, got, overflow), std::invalid_argument);
+    }
+    else
+    {
+      auto count = foo.checked_multiply(tc.in.a, tc.in.b, got, overflow);
+      EXPECT_EQ(got, tc.want.result);
+      EXPECT_EQ(overflow, tc.want.overflow);
+      EXPECT_EQ(count, tc.want.count);
+    }
+  }
+}
+
+TEST(FooTest, SaturatingMultiply)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      int a;
+      int b;
+    } in;
+
+    struct Want
+    {
+      int result;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"no overflow", /* in */ {-4, 5}, /* want */ {-20}},
+      {"overflow: int max * 2", /* in */ {INT_MAX, 2}, /* want */ {INT_MAX}},
+      {"overflow: int max * -2", /* in */ {INT_MAX, -2}, /* want */ {INT_MIN}},
+      {"overflow: int min * -1", /* in */ {INT_MIN, -1}, /* want */ {INT_MAX}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+
+    // Act
+    auto got = foo.saturating_multiply(tc.in.a, tc.in.b);
+
+    // Assert
+    EXPECT_EQ(got, tc.want.result);
+  }
+}
+
+TEST(FooTest, SaturatingMultiplyBatch)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::vector<int> a;
+      std::vector<int> b;
+    } in;
+
+    struct Want
+    {
+      std::vector<int> result;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"empty spans", /* in */ {{}, {}}, /* want */ {{}}},
+      {"vector body and tail",
+       /* in */ {{65536, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, INT_MIN}, {-65536, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, -1}},
+       /* want */ {{INT_MIN, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, INT_MAX}}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+    std::vector<int> got(tc.in.a.size());
+
+    // Act
+    foo.saturating_multiply(tc.in.a, tc.in.b, got);
+
+    // Assert
+    EXPECT_EQ(got, tc.want.result);
+  }
+}
+
+TEST(FooTest, Divide)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      int numerator;
+      int denominator;
+    } in;
+
+    struct Want
+    {
+      double result;
+      bool throws_exception;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"positive division", /* in */ {10, 2}, /* want */ {5.0, false}},
+      {"negative division", /* in */ {-10, 2}, /* want */ {-5.0, false}},
+      {"mixed sign division", /* in */ {10, -2}, /* want */ {-5.0, false}},
+      {"zero numerator", /* in */ {0, 5}, /* want */ {0.0, false}},
+      {"division by one", /* in */ {10, 1}, /* want */ {10.0, false}},
+      {"division with remainder", /* in */ {7, 2}, /* want */ {3.0, false}},
+      {"division by zero", /* in */ {10, 0}, /* want */ {0.0, true}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(foo.divide(tc.in.numerator, tc.in.denominator), std::invalid_argument);
+    }
+    else
+    {
+      auto got = foo.divide(tc.in.numerator, tc.in.denominator);
+      EXPECT_DOUBLE_EQ(got, tc.want.result);
+    }
+  }
+}
+
+TEST(FooTest, DivideBatch)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::vector<int> numerators;
+      int denominator;
+    } in;
+
+    struct Want
+    {
+      std::vector<double> result;
+      bool throws_exception;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"empty span", /* in */ {{}, 2}, /* want */ {{}, false}},
+      {"division with remainder", /* in */ {{7, -7, 10, 0}, 2}, /* want */ {{3.0, -3.0, 5.0, 0.0}, false}},
+      {"vector body and tail",
+       /* in */ {{0, 7, 14, 21, 28, 35, 42, 49, 56, 63, 70, 77, 84, 91, 98, 105, -112}, -7},
+       /* want */ {{0.0, -1.0, -2.0, -3.0, -4.0, -5.0, -6.0, -7.0, -8.0, -9.0, -10.0, -11.0, -12.0, -13.0, -14.0, -15.0, 16.0}, false}},
+      {"division by zero", /* in */ {{10}, 0}, /* want */ {{}, true}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+    std::vector<double> got(tc.in.numerators.size());
+
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(foo.divide(tc.in.numerators, tc.in.denominator, got), std::invalid_argument);
+    }
+    else
+    {
+      foo.divide(tc.in.numerators, tc.in.denominator, got);
+      EXPECT_EQ(got, tc.want.result);
+    }
+  }
+}
+
+class FooFixture : public ::testing::Test
+{
+protected:
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::string text;
+    } in;
+
+    struct Want
+    {
+      std::string result;
+    } want;
+  };
+
+  // Data-Driven Testing
+  std::vector<Tests> tests;
+
+  void SetUp() override
+  {
+    // Load JSON
+    std::string filename = "foo_test.json";
+    std::filesystem::path filepath = std::filesystem::path(__FILE__).parent_path() / filename;
+    std::ifstream file(filepath);
+    ASSERT_TRUE(file.good()) << "Failed to open JSON: " << filepath.string();
+
+    // Parse JSON
+    nlohmann::json data = nlohmann::json::parse(file);
+    for (const auto &row : data["foo::greet"])
+    {
+      Tests tmp;
+      tmp.label = row.at("label").get<std::string>();
+      tmp.in.text = row.at("in").at("text").get<std::string>();
+      tmp.want.result = row.at("want").at("result").get<std::string>();
+
+      tests.push_back(std::move(tmp));
+    }
+
+    ASSERT_FALSE(tests.empty()) << "Failed to parse JSON: " << filepath.string();
+  }
+
+  void TearDown() override
+  {
+    // Cleanup
+    tests.clear();
+  }
+};
+
+TEST_F(FooFixture, Greet)
+{
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+
+    // Act
+    auto got = foo.greet(tc.in.text);
+
+    // Assert
+    EXPECT_EQ(got, tc.want.result);
+  }
+}
+
+TEST(FooTest, IsEven)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      int n;
+    } in;
+
+    struct Want
+    {
+      bool result;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"positive even", /* in */ {4}, /* want */ {true}},
+      {"positive odd", /* in */ {3}, /* want */ {false}},
+      {"negative even", /* in */ {-4}, /* want */ {true}},
+      {"negative odd", /* in */ {-3}, /* want */ {false}},
+      {"zero", /* in */ {0}, /* want */ {true}},
+      {"boundary: int max", /* in */ {INT_MAX}, /* want */ {false}},
+      {"boundary: int min", /* in */ {INT_MIN}, /* want */ {true}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+
+    // Act
+    auto got = foo.is_even(tc.in.n);
+
+    // Assert
+    EXPECT_EQ(got, tc.want.result);
+  }
+}
+
+TEST(FooTest, Reverse)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::string text;
+    } in;
+
+    struct Want
+    {
+      std::string result;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"normal string", /* in */ {"hello"}, /* want */ {"olleh"}},
+      {"empty string", /* in */ {""}, /* want */ {""}},
+      {"single character", /* in */ {"a"}, /* want */ {"a"}},
+      {"palindrome", /* in */ {"racecar"}, /* want */ {"racecar"}},
+      {"spaces", /* in */ {"hello test"}, /* want */ {"tset olleh"}},
+      {"special characters", /* in */ {"!@#$%"}, /* want */ {"%$#@!"}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+
+    // Act
+    auto got = foo.reverse(tc.in.text);
+
+    // Assert
+    EXPECT_EQ(got, tc.want.result);
+  }
+}
+
+TEST(FooTest, Factorial)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      int n;
+    } in;
+
+    struct Want
+    {
+      unsigned long long result;
+      bool throws_exception;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"factorial of zero", /* in */ {0}, /* want */ {1, false}},
+      {"factorial of one", /* in */ {1}, /* want */ {1, false}},
+      {"factorial of two", /* in */ {2}, /* want */ {2, false}},
+      {"factorial of five", /* in */ {5}, /* want */ {120, false}},
+      {"factorial of ten", /* in */ {10}, /* want */ {3628800, false}},
+      {"negative input", /* in */ {-1}, /* want */ {0, true}},
+      {"boundary: large number", /* in */ {20}, /* want */ {2432902008176640000ULL, false}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(foo.factorial(tc.in.n), std::invalid_argument);
+    }
+    else
+    {
+      auto got = foo.factorial(tc.in.n);
+      EXPECT_EQ(got, tc.want.result);
+    }
+  }
+}
+
+TEST(FooTest, FactorialMatchesLoop)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      int last;
+    } in;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"exact range, wrapped range and the zero tail", /* in */ {200}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+    unsigned long long want = 1;
+
+    for (int n = 0; n <= tc.in.last; ++n)
+    {
+      // Act
+      auto got = foo.factorial(n);
+
+      // Assert
+      EXPECT_EQ(got, want) << "n = " << n;
+      want *= static_cast<unsigned long long>(n + 1);
+    }
+  }
+}
+
+TEST(FooTest, Factorial128)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      int n;
+    } in;
+
+    struct Want
+    {
+      std::uint64_t high;
+      std::uint64_t low;
+      bool throws_exception;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"factorial of zero", /* in */ {0}, /* want */ {0, 1, false}},
+      {"first value past 64 bits", /* in */ {21}, /* want */ {2, 14197454024290336768ULL, false}},
+      {"boundary: largest exact value", /* in */ {34}, /* want */ {16004602105385757826ULL, 4926277576697053184ULL, false}},
+      {"overflow wraps modulo 2^128", /* in */ {35}, /* want */ {6758751477214975439ULL, 6399018521010896896ULL, false}},
+      {"last non-zero value", /* in */ {129}, /* want */ {std::uint64_t{1} << 63, 0, false}},
+      {"2^128 divides 130!", /* in */ {130}, /* want */ {0, 0, false}},
+      {"negative input", /* in */ {-1}, /* want */ {0, 0, true}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(foo.factorial128(tc.in.n), std::invalid_argument);
+    }
+    else
+    {
+      auto got = foo.factorial128(tc.in.n);
+      EXPECT_EQ(static_cast<std::uint64_t>(got >> 64), tc.want.high);
+      EXPECT_EQ(static_cast<std::uint64_t>(got), tc.want.low);
+    }
+  }
+}
+
+TEST(FooTest, Factorial256)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      int n;
+    } in;
+
+    struct Want
+    {
+      std::string factorial;
+      bool throws_exception;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"factorial of zero", /* in */ {0}, /* want */ {"1", false}},
+      {"first value past 128 bits", /* in */ {35}, /* want */ {"10333147966386144929666651337523200000000", false}},
+      {"boundary: largest exact value", /* in */ {57}, /* want */ {"40526919504877216755680601905432322134980384796226602145184481280000000000000", false}},
+      {"overflow wraps modulo 2^256", /* in */ {58}, /* want */ {"34719546536554663358055210341316526763462624868331643631548234081737407201280", false}},
+      {"last non-zero value is the minimum", /* in */ {257}, /* want */ {"-57896044618658097711785492504343953926634992332820282019728792003956564819968", false}},
+      {"2^256 divides 258!", /* in */ {258}, /* want */ {"0", false}},
+      {"negative input", /* in */ {-1}, /* want */ {"", true}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(foo.factorial256(tc.in.n), std::invalid_argument);
+    }
+    else
+    {
+      EXPECT_EQ(foo.factorial256(tc.in.n).to_string(), tc.want.factorial);
+    }
+  }
+}
+
+TEST(FooTest, FactorialBig)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      int n;
+      unsigned threads;
+    } in;
+
+    struct Want
+    {
+      std::size_t digits;
+      std::string leading;
+      std::size_t trailing_zeros;
+      bool throws_exception;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"factorial of zero", /* in */ {0, 1}, /* want */ {1, "1", 0, false}},
+      {"factorial of one", /* in */ {1, 1}, /* want */ {1, "1", 0, false}},
+      {"boundary: largest 64-bit value", /* in */ {20, 1}, /* want */ {19, "2432902008176640000", 4, false}},
+      {"first 64-bit overflow", /* in */ {21, 1}, /* want */ {20, "51090942171709440000", 4, false}},
+      {"several limbs", /* in */ {100, 1}, /* want */ {158, "93326215443944152681", 24, false}},
+      {"past the Karatsuba threshold", /* in */ {1000, 1}, /* want */ {2568, "40238726007709377354", 249, false}},
+      {"split products on one thread", /* in */ {50000, 1}, /* want */ {213237, "33473205095971448369", 12499, false}},
+      {"split products on four threads", /* in */ {50000, 4}, /* want */ {213237, "33473205095971448369", 12499, false}},
+      {"negative input", /* in */ {-1, 1}, /* want */ {0, "", 0, true}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(foo.factorial_big(tc.in.n, tc.in.threads), std::invalid_argument);
+      continue;
+    }
+
+    const std::string got = foo.factorial_big(tc.in.n, tc.in.threads).to_string();
+    ASSERT_EQ(got.size(), tc.want.digits);
+    EXPECT_EQ(got.substr(0, tc.want.leading.size()), tc.want.leading);
+    EXPECT_EQ(got.size() - 1 - got.find_last_not_of('0'), tc.want.trailing_zeros);
+  }
+}
+
+TEST(FooTest, FactorialBigMatchesProduct)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      int last;
+      unsigned threads;
+    } in;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"every swing shape up to 300", /* in */ {300, 2}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+    BigInt want = 1U;
+
+    for (int n = 0; n <= tc.in.last; ++n)
+    {
+      // Act
+      auto got = foo.factorial_big(n, tc.in.threads);
+
+      // Assert
+      EXPECT_EQ(got, want) << "n = " << n;
+      want *= static_cast<std::uint64_t>(n + 1);
+    }
+  }
+}
+
+namespace
+{
+
+  // Forces constant evaluation, so a call that cannot be folded fails to compile
+  template <auto value>
+  constexpr auto constant = value;
+
+} // namespace
+
+TEST(FooTest, ConstantEvaluation)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      unsigned long long folded;
+      int n;
+      bool factorial;
+    } in;
+  };
+
+  // Table-Driven Testing
+  constexpr Foo folder{};
+  const std::vector<Tests> tests = {
+      {"factorial of zero", /* in */ {constant<folder.factorial(0)>, 0, true}},
+      {"largest exact factorial", /* in */ {constant<folder.factorial(20)>, 20, true}},
+      {"last non-zero wrapped factorial", /* in */ {constant<folder.factorial(65)>, 65, true}},
+      {"factorial past the table", /* in */ {constant<folder.factorial(1000)>, 1000, true}},
+      {"fibonacci of zero", /* in */ {constant<folder.fibonacci(0)>, 0, false}},
+      {"largest exact fibonacci", /* in */ {constant<folder.fibonacci(93)>, 93, false}},
+      {"fibonacci past the table", /* in */ {constant<folder.fibonacci(1000)>, 1000, false}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+
+    // Act
+    auto got = tc.in.factorial ? foo.factorial(tc.in.n) : foo.fibonacci(tc.in.n);
+
+    // Assert
+    EXPECT_EQ(tc.in.folded, got);
+  }
+}
+
+TEST(FooTest, Spline)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      double x0;
+      double y0;
+      double x1;
+      double y1;
+      double x;
+    } in;
+
+    struct Want
+    {
+      double result;
+      bool throws_exception;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"x at x0", /* in */ {0, 0, 10, 20, 0}, /* want */ {0.0, false}},
+      {"x at x1", /* in */ {0, 0, 10, 20, 10}, /* want */ {20.0, false}},
+      {"negative coordinates", /* in */ {-5, -10, 5, 10, 0}, /* want */ {0.0, false}},
+      {"x between points", /* in */ {1, 2, 3, 6, 2}, /* want */ {4.0, false}},
+      {"same x0 and x1", /* in */ {5, 10, 5, 15, 5}, /* want */ {0.0, true}},
+      {"x beyond range", /* in */ {0, 0, 10, 20, 15}, /* want */ {30.0, false}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(foo.spline(tc.in.x0, tc.in.y0, tc.in.x1, tc.in.y1, tc.in.x), std::invalid_argument);
+    }
+    else
+    {
+      auto got = foo.spline(tc.in.x0, tc.in.y0, tc.in.x1, tc.in.y1, tc.in.x);
+      EXPECT_DOUBLE_EQ(got, tc.want.result);
+    }
+  }
+}
+
+TEST(FooTest, Fibonacci)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      int n;
+    } in;
+
+    struct Want
+    {
+      unsigned long long result;
+      bool throws_exception;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"fibonacci of zero", /* in */ {0}, /* want */ {0, false}},
+      {"fibonacci of one", /* in */ {1}, /* want */ {1, false}},
+      {"fibonacci of two", /* in */ {2}, /* want */ {1, false}},
+      {"fibonacci of three", /* in */ {3}, /* want */ {2, false}},
+      {"fibonacci of four", /* in */ {4}, /* want */ {3, false}},
+      {"fibonacci of five", /* in */ {5}, /* want */ {5, false}},
+      {"fibonacci of ten", /* in */ {10}, /* want */ {55, false}},
+      {"fibonacci of fifteen", /* in */ {15}, /* want */ {610, false}},
+      {"negative input", /* in */ {-1}, /* want */ {0, true}},
+      {"boundary: large number", /* in */ {50}, /* want */ {12586269025ULL, false}},
+      {"boundary: largest exact value", /* in */ {93}, /* want */ {12200160415121876738ULL, false}},
+      {"overflow wraps modulo 2^64", /* in */ {94}, /* want */ {1293530146158671551ULL, false}},
+      {"far past overflow", /* in */ {300}, /* want */ {17658870469870104080ULL, false}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(foo.fibonacci(tc.in.n), std::invalid_argument);
+    }
+    else
+    {
+      auto got = foo.fibonacci(tc.in.n);
+      EXPECT_EQ(got, tc.want.result);
+    }
+  }
+}
+
+TEST(FooTest, FibonacciMatchesLoop)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      int last;
+    } in;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"exact range and well past the 64-bit overflow", /* in */ {1000}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+    unsigned long long a = 0;
+    unsigned long long b = 1;
+    uint128_t wide_a = 0;
+    uint128_t wide_b = 1;
+
+    for (int n = 0; n <= tc.in.last; ++n)
+    {
+      // Act
+      auto got = foo.fibonacci(n);
+      auto got_wide = foo.fibonacci128(n);
+
+      // Assert
+      EXPECT_EQ(got, a) << "n = " << n;
+      EXPECT_TRUE(got_wide == wide_a) << "n = " << n;
+      b = std::exchange(a, b) + b;
+      wide_b = std::exchange(wide_a, wide_b) + wide_b;
+    }
+  }
+}
+
+TEST(FooTest, Fibonacci128)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      int n;
+    } in;
+
+    struct Want
+    {
+      std::uint64_t high;
+      std::uint64_t low;
+      bool throws_exception;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"fibonacci of zero", /* in */ {0}, /* want */ {0, 0, false}},
+      {"fibonacci of ten", /* in */ {10}, /* want */ {0, 55, false}},
+      {"first value past 64 bits", /* in */ {94}, /* want */ {1, 1293530146158671551ULL, false}},
+      {"fibonacci of 128", /* in */ {128}, /* want */ {13646246, 18154666814248790725ULL, false}},
+      {"boundary: largest exact value", /* in */ {186}, /* want */ {18042485370706291343ULL, 14458561666841997560ULL, false}},
+      {"overflow wraps modulo 2^128", /* in */ {187}, /* want */ {10746610497615974171ULL, 17923856557765508741ULL, false}},
+      {"negative input", /* in */ {-1}, /* want */ {0, 0, true}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(foo.fibonacci128(tc.in.n), std::invalid_argument);
+    }
+    else
+    {
+      auto got = foo.fibonacci128(tc.in.n);
+      EXPECT_EQ(static_cast<std::uint64_t>(got >> 64), tc.want.high);
+      EXPECT_EQ(static_cast<std::uint64_t>(got), tc.want.low);
+    }
+  }
+}
+
+TEST(FooTest, Fibonacci256)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      int n;
+    } in;
+
+    struct Want
+    {
+      std::string fibonacci;
+      bool throws_exception;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"fibonacci of zero", /* in */ {0}, /* want */ {"0", false}},
+      {"fibonacci of ten", /* in */ {10}, /* want */ {"55", false}},
+      {"first value past 128 bits", /* in */ {187}, /* want */ {"538522340430300790495419781092981030533", false}},
+      {"boundary: largest exact value", /* in */ {368}, /* want */ {"36138207717265885328441519836863123286695915870773021050058862406562749608741", false}},
+      {"overflow wraps to negative", /* in */ {369}, /* want */ {"-57319240858276242738717133271786774613528717774183719482195828093874065994142", false}},
+      {"negative input", /* in */ {-1}, /* want */ {"", true}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(foo.fibonacci256(tc.in.n), std::invalid_argument);
+    }
+    else
+    {
+      EXPECT_EQ(foo.fibonacci256(tc.in.n).to_string(), tc.want.fibonacci);
+    }
+  }
+}
+
+TEST(FooTest, CheckedFibonacci)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      int n;
+    } in;
+
+    struct Want
+    {
+      bool overflow;
+      bool overflow_128;
+      bool overflow_256;
+      bool throws_exception;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"fibonacci of zero", /* in */ {0}, /* want */ {false, false, false, false}},
+      {"boundary: largest 64-bit value", /* in */ {93}, /* want */ {false, false, false, false}},
+      {"first 64-bit overflow", /* in */ {94}, /* want */ {true, false, false, false}},
+      {"boundary: largest 128-bit value", /* in */ {186}, /* want */ {true, false, false, false}},
+      {"first 128-bit overflow", /* in */ {187}, /* want */ {true, true, false, false}},
+      {"boundary: largest 256-bit value", /* in */ {368}, /* want */ {true, true, false, false}},
+      {"first 256-bit overflow", /* in */ {369}, /* want */ {true, true, true, false}},
+      {"negative input", /* in */ {-1}, /* want */ {false, false, false, true}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+    unsigned long long got = 0;
+    uint128_t got_wide = 0;
+    Int256 got_256;
+
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(foo.checked_fibonacci(tc.in.n, got), std::invalid_argument);
+      EXPECT_THROW(foo.checked_fibonacci(tc.in.n, got_wide), std::invalid_argument);
+      EXPECT_THROW(foo.checked_fibonacci(tc.in.n, got_256), std::invalid_argument);
+    }
+    else
+    {
+      EXPECT_EQ(foo.checked_fibonacci(tc.in.n, got), tc.want.overflow);
+      EXPECT_EQ(foo.checked_fibonacci(tc.in.n, got_wide), tc.want.overflow_128);
+      EXPECT_EQ(foo.checked_fibonacci(tc.in.n, got_256), tc.want.overflow_256);
+      EXPECT_EQ(got, foo.fibonacci(tc.in.n));
+      EXPECT_TRUE(got_wide == foo.fibonacci128(tc.in.n));
+      EXPECT_EQ(got_256, foo.fibonacci256(tc.in.n));
+    }
+  }
+}
+
+TEST(FooTest, FibonacciBig)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      int n;
+    } in;
+
+    struct Want
+    {
+      std::size_t digits;
+      std::string leading;
+      std::string trailing;
+      bool throws_exception;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"fibonacci of zero", /* in */ {0}, /* want */ {1, "0", "0", false}},
+      {"fibonacci of one", /* in */ {1}, /* want */ {1, "1", "1", false}},
+      {"boundary: largest 64-bit value", /* in */ {93}, /* want */ {20, "12200160415121876738", "12200160415121876738", false}},
+      {"first 64-bit overflow", /* in */ {94}, /* want */ {20, "19740274219868223167", "19740274219868223167", false}},
+      {"first 128-bit overflow", /* in */ {187}, /* want */ {39, "538522340430300790495419781092981030533", "538522340430300790495419781092981030533", false}},
+      {"several limbs", /* in */ {300}, /* want */ {63, "222232244629420445529739893461909967206666939096499764990979600", "222232244629420445529739893461909967206666939096499764990979600", false}},
+      {"past the Karatsuba threshold", /* in */ {100000}, /* want */ {20899, "25974069347221724166", "49895374653428746875", false}},
+      {"negative input", /* in */ {-1}, /* want */ {0, "", "", true}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(foo.fibonacci_big(tc.in.n), std::invalid_argument);
+      continue;
+    }
+
+    const std::string got = foo.fibonacci_big(tc.in.n).to_string();
+    ASSERT_EQ(got.size(), tc.want.digits);
+    EXPECT_EQ(got.substr(0, tc.want.leading.size()), tc.want.leading);
+    EXPECT_EQ(got.substr(got.size() - tc.want.trailing.size()), tc.want.trailing);
+    if (tc.in.n <= 93)
+    {
+      EXPECT_EQ(got, std::to_string(foo.fibonacci(tc.in.n)));
+    }
+  }
+}
+
+TEST(FooTest, FibonacciMod)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::uint64_t n;
+      std::uint64_t m;
+    } in;
+
+    struct Want
+    {
+      std::uint64_t result;
+      bool throws_exception;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"fibonacci of zero", /* in */ {0, 10}, /* want */ {0, false}},
+      {"modulus one", /* in */ {10, 1}, /* want */ {0, false}},
+      {"largest exact 64-bit value", /* in */ {93, 18446744073709551615ULL}, /* want */ {12200160415121876738ULL, false}},
+      {"prime modulus", /* in */ {100, 1000000007}, /* want */ {687995182, false}},
+      {"huge index", /* in */ {1000000000000000000ULL, 1000000007}, /* want */ {209783453, false}},
+      {"one period past five", /* in */ {2000000021, 1000000007}, /* want */ {5, false}},
+      {"power-of-two modulus", /* in */ {1000000000000000000ULL, 9223372036854775808ULL}, /* want */ {3919126379787055675ULL, false}},
+      {"even composite modulus", /* in */ {18446744073709551615ULL, 1000000000}, /* want */ {362999010, false}},
+      {"even modulus with a large odd part", /* in */ {1000000000000000000ULL, 6000000000}, /* want */ {5560546875, false}},
+      {"odd prime power", /* in */ {12345678901234567ULL, 12157665459056928801ULL}, /* want */ {2866275494734188496ULL, false}},
+      {"largest 64-bit prime", /* in */ {18446744073709551615ULL, 18446744073709551557ULL}, /* want */ {18446743708274255395ULL, false}},
+      {"largest modulus", /* in */ {18446744073709551615ULL, 18446744073709551615ULL}, /* want */ {4093298358055684510ULL, false}},
+      {"zero modulus", /* in */ {1, 0}, /* want */ {0, true}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(foo.fibonacci_mod(tc.in.n, tc.in.m), std::invalid_argument);
+    }
+    else
+    {
+      EXPECT_EQ(foo.fibonacci_mod(tc.in.n, tc.in.m), tc.want.result);
+      EXPECT_EQ(foo.fibonacci_mod(tc.in.n, tc.in.m), tc.want.result); // Period now cached
+    }
+  }
+}
+
+TEST(FooTest, FibonacciModMatchesLoop)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::uint64_t m;
+    } in;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"modulus two", /* in */ {2}},
+      {"modulus ten", /* in */ {10}},
+      {"power of five", /* in */ {125}},
+      {"prime that splits mod 5", /* in */ {11}},
+      {"prime that stays inert mod 5", /* in */ {13}},
+      {"mixed prime powers", /* in */ {2 * 2 * 3 * 3 * 7 * 7}},
+      {"period longer than the range", /* in */ {1000003}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+    constexpr std::uint64_t count = 5000;
+    std::vector<std::uint64_t> want;
+    for (std::uint64_t a = 0, b = 1 % tc.in.m, i = 0; i < count; ++i)
+    {
+      want.push_back(a);
+      b = std::exchange(a, b) + b;
+      b %= tc.in.m;
+    }
+
+    // Act
+    std::vector<std::uint64_t> got;
+    for (std::uint64_t n = 0; n < count; ++n)
+    {
+      got.push_back(foo.fibonacci_mod(n, tc.in.m));
+    }
+
+    // Assert
+    EXPECT_EQ(got, want);
+  }
+}
+
+TEST(FooTest, FibonacciModBatch)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::vector<std::uint64_t> indices;
+      std::uint64_t m;
+      std::size_t out_size;
+    } in;
+
+    struct Want
+    {
+      bool throws_exception;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"empty batch", /* in */ {{}, 1000000007, 0}, /* want */ {false}},
+      {"prime modulus", /* in */ {{0, 1, 93, 1000000000000000000ULL, 18446744073709551615ULL}, 1000000007, 5}, /* want */ {false}},
+      {"even modulus", /* in */ {{7, 500, 123456789012345ULL, 18446744073709551615ULL}, 6000000000, 4}, /* want */ {false}},
+      {"modulus one", /* in */ {{3, 4, 5}, 1, 3}, /* want */ {false}},
+      {"mismatched sizes", /* in */ {{1, 2}, 10, 1}, /* want */ {true}},
+      {"zero modulus", /* in */ {{1}, 0, 1}, /* want */ {true}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+    std::vector<std::uint64_t> got(tc.in.out_size, 1);
+
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(foo.fibonacci_mod(tc.in.indices, tc.in.m, got), std::invalid_argument);
+      continue;
+    }
+
+    foo.fibonacci_mod(tc.in.indices, tc.in.m, got);
+    for (std::size_t i = 0; i < got.size(); ++i)
+    {
+      EXPECT_EQ(got[i], foo.fibonacci_mod(tc.in.indices[i], tc.in.m));
+    }
+  }
+}
+
+TEST(FooTest, IsPrime)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      int n;
+    } in;
+
+    struct Want
+    {
+      bool result;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"prime number 2", /* in */ {2}, /* want */ {true}},
+      {"prime number 3", /* in */ {3}, /* want */ {true}},
+      {"prime number 11", /* in */ {11}, /* want */ {true}},
+      {"prime number 17", /* in */ {17}, /* want */ {true}},
+      {"non-prime 1", /* in */ {1}, /* want */ {false}},
+      {"non-prime 4", /* in */ {4}, /* want */ {false}},
+      {"non-prime 6", /* in */ {6}, /* want */ {false}},
+      {"non-prime 9", /* in */ {9}, /* want */ {false}},
+      {"negative number", /* in */ {-5}, /* want */ {false}},
+      {"large prime 97", /* in */ {97}, /* want */ {true}},
+      {"large non-prime 100", /* in */ {100}, /* want */ {false}},
+      {"large prime 997", /* in */ {997}, /* want */ {true}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+
+    // Act
+    auto got = foo.is_prime(tc.in.n);
+
+    // Assert
+    EXPECT_EQ(got, tc.want.result);
+  }
+}
+
+TEST(FooTest, IsPrime64)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::uint64_t n;
+    } in;
+
+    struct Want
+    {
+      bool result;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"zero", /* in */ {0}, /* want */ {false}},
+      {"one", /* in */ {1}, /* want */ {false}},
+      {"smallest prime", /* in */ {2}, /* want */ {true}},
+      {"last table prime", /* in */ {61}, /* want */ {true}},
+      {"first prime above table", /* in */ {67}, /* want */ {true}},
+      {"square of first prime above table", /* in */ {67 * 67}, /* want */ {false}},
+      {"carmichael 561", /* in */ {561}, /* want */ {false}},
+      {"strong pseudoprime to base 2", /* in */ {2047}, /* want */ {false}},
+      {"strong pseudoprime to bases 2, 3, 5, 7", /* in */ {3215031751ULL}, /* want */ {false}},
+      {"strong pseudoprime to bases up to 37", /* in */ {3825123056546413051ULL}, /* want */ {false}},
+      {"boundary: int max", /* in */ {2147483647ULL}, /* want */ {true}},
+      {"mersenne prime 2^61 - 1", /* in */ {2305843009213693951ULL}, /* want */ {true}},
+      {"product of two 32-bit primes", /* in */ {18446743979220271189ULL}, /* want */ {false}},
+      {"square of a 32-bit prime", /* in */ {18446744030759878681ULL}, /* want */ {false}},
+      {"boundary: largest 64-bit prime", /* in */ {18446744073709551557ULL}, /* want */ {true}},
+      {"boundary: uint64 max", /* in */ {18446744073709551615ULL}, /* want */ {false}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+
+    // Act
+    auto got = foo.is_prime(tc.in.n);
+
+    // Assert
+    EXPECT_EQ(got, tc.want.result);
+  }
+}
+
+TEST(FooTest, IsPrimeIntegralTypes)
+{
+  // Arrange
+  Foo foo;
+
+  // Act & Assert
+  // Each call must resolve to a single overload for its argument type
+  EXPECT_TRUE(foo.is_prime(7));
+  EXPECT_TRUE(foo.is_prime(7u));
+  EXPECT_TRUE(foo.is_prime(7L));
+  EXPECT_TRUE(foo.is_prime(7UL));
+  EXPECT_TRUE(foo.is_prime(7LL));
+  EXPECT_TRUE(foo.is_prime(static_cast<short>(7)));
+  EXPECT_TRUE(foo.is_prime(static_cast<unsigned char>(7)));
+  EXPECT_TRUE(foo.is_prime(std::uint64_t{7}));
+  EXPECT_FALSE(foo.is_prime(-7L));
+  EXPECT_FALSE(foo.is_prime(std::numeric_limits<long>::min()));
+  EXPECT_TRUE(foo.is_prime(4294967291u));
+  EXPECT_TRUE(foo.is_prime(9223372036854775783L));
+}
+
+TEST(FooTest, IsPrimeMatchesTrialDivision)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      int first;
+      int last;
+    } in;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"small integers", /* in */ {-10, 20000}},
+      {"near int max", /* in */ {INT_MAX - 2000, INT_MAX}},
+  };
+
+  // Reference trial division, widened so the square cannot overflow
+  auto reference = [](int n)
+  {
+    if (n <= 1)
+    {
+      return false;
+    }
+    for (long long i = 2; i * i <= n; ++i)
+    {
+      if (n % i == 0)
+      {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+
+    // Act & Assert
+    for (int n = tc.in.first;; ++n)
+    {
+      ASSERT_EQ(foo.is_prime(n), reference(n)) << "n " << n;
+      if (n > 0)
+      {
+        ASSERT_EQ(foo.is_prime(static_cast<std::uint64_t>(n)), reference(n)) << "n " << n;
+      }
+      if (n == tc.in.last)
+      {
+        break;
+      }
+    }
+  }
+}
+
+TEST(FooTest, IsPrimeBatch)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::vector<std::uint32_t> values;
+      std::size_t mask_size;
+    } in;
+
+    struct Want
+    {
+      std::vector<std::uint64_t> mask;
+      std::size_t count;
+      bool throws_exception;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"empty span", /* in */ {{}, 0}, /* want */ {{}, 0, false}},
+      {"scalar tail", /* in */ {{0, 1, 2, 3, 4, 5}, 1}, /* want */ {{0b101100}, 3, false}},
+      {"vector body and tail",
+       /* in */ {{61, 67, 4489, 4493, 561, 2047, 3215031751U, 4294967291U, 4294967295U, 7}, 1},
+       /* want */ {{0b1010001011}, 5, false}},
+      {"mask too small", /* in */ {{2, 3}, 0}, /* want */ {{}, 0, true}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+    std::vector<std::uint64_t> got(tc.in.mask_size, ~std::uint64_t{0});
+
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(foo.is_prime(tc.in.values, got), std::invalid_argument);
+    }
+    else
+    {
+      EXPECT_EQ(foo.is_prime(tc.in.values, got), tc.want.count);
+      EXPECT_EQ(got, tc.want.mask);
+    }
+  }
+}
+
+TEST(FooTest, IsPrimeBatchMatchesScalar)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::uint32_t first;
+      std::uint32_t stride;
+    } in;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"small integers", /* in */ {0, 1}},
+      {"odd integers past trial division", /* in */ {4401, 2}},
+      {"spread over 32 bits", /* in */ {12345, 2654435761U}},
+      {"boundary: uint32 max", /* in */ {4294967295U - 10006, 1}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+    std::vector<std::uint32_t> values(10007);
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+      values[i] = tc.in.first + static_cast<std::uint32_t>(i) * tc.in.stride;
+    }
+    std::vector<std::uint64_t> mask((values.size() + 63) / 64);
+
+    // Act
+    auto count = foo.is_prime(values, mask);
+
+    // Assert
+    std::size_t want = 0;
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+      const bool prime = foo.is_prime(std::uint64_t{values[i]});
+      want += prime ? 1 : 0;
+      ASSERT_EQ(((mask[i / 64] >> (i % 64)) & 1) != 0, prime) << "value " << values[i];
+    }
+    EXPECT_EQ(count, want);
+    EXPECT_EQ(mask.back() >> (values.size() % 64), 0U);
+  }
+}
+
+TEST(FooTest, PrimesIn)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::uint64_t first;
+      std::uint64_t last;
+    } in;
+
+    struct Want
+    {
+      std::vector<std::uint64_t> result;
+      bool throws_exception;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"empty range", /* in */ {10, 10}, /* want */ {{}, false}},
+      {"reversed range", /* in */ {10, 5}, /* want */ {{}, false}},
+      {"below two", /* in */ {0, 2}, /* want */ {{}, false}},
+      {"wheel primes", /* in */ {0, 30}, /* want */ {{2, 3, 5, 7, 11, 13, 17, 19, 23, 29}, false}},
+      {"exclusive upper bound", /* in */ {2, 7}, /* want */ {{2, 3, 5}, false}},
+      {"inclusive lower bound", /* in */ {7, 12}, /* want */ {{7, 11}, false}},
+      {"unaligned window", /* in */ {89, 114}, /* want */ {{89, 97, 101, 103, 107, 109, 113}, false}},
+      {"prime gap", /* in */ {1328, 1361}, /* want */ {{}, false}},
+      {"beyond the sieve limit", /* in */ {0, (std::uint64_t{1} << 62) + 1}, /* want */ {{}, true}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(foo.primes_in(tc.in.first, tc.in.last), std::invalid_argument);
+      EXPECT_THROW(foo.count_primes(tc.in.first, tc.in.last), std::invalid_argument);
+    }
+    else
+    {
+      EXPECT_EQ(foo.primes_in(tc.in.first, tc.in.last), tc.want.result);
+      EXPECT_EQ(foo.count_primes(tc.in.first, tc.in.last), tc.want.result.size());
+    }
+  }
+}
+
+TEST(FooTest, CountPrimes)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::uint64_t first;
+      std::uint64_t last;
+      unsigned threads;
+    } in;
+
+    struct Want
+    {
+      std::uint64_t result;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"pi(10^3)", /* in */ {0, 1000, 1}, /* want */ {168}},
+      {"pi(10^6)", /* in */ {0, 1000000, 1}, /* want */ {78498}},
+      {"pi(10^7) on one thread", /* in */ {0, 10000000, 1}, /* want */ {664579}},
+      {"pi(10^7) on four threads", /* in */ {0, 10000000, 4}, /* want */ {664579}},
+      {"pi(10^8)", /* in */ {0, 100000000, 0}, /* want */ {5761455}},
+      {"pi(10^8) - pi(10^7 + 1)", /* in */ {10000001, 100000000, 0}, /* want */ {5761455 - 664579}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+
+    // Act
+    auto got = foo.count_primes(tc.in.first, tc.in.last, tc.in.threads);
+
+    // Assert
+    EXPECT_EQ(got, tc.want.result);
+  }
+}
+
+TEST(FooTest, PrimePi)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::uint64_t x;
+      unsigned threads;
+    } in;
+
+    struct Want
+    {
+      std::uint64_t result;
+      bool throws_exception;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"zero", /* in */ {0, 1}, /* want */ {0, false}},
+      {"one", /* in */ {1, 1}, /* want */ {0, false}},
+      {"two", /* in */ {2, 1}, /* want */ {1, false}},
+      {"ten", /* in */ {10, 1}, /* want */ {4, false}},
+      {"x is a prime square", /* in */ {49, 1}, /* want */ {15, false}},
+      {"x is one below a prime square", /* in */ {48, 1}, /* want */ {15, false}},
+      {"pi(10^3)", /* in */ {1000, 1}, /* want */ {168, false}},
+      {"pi(10^6)", /* in */ {1000000, 1}, /* want */ {78498, false}},
+      {"pi(10^9) on one thread", /* in */ {1000000000, 1}, /* want */ {50847534, false}},
+      {"pi(10^9) on four threads", /* in */ {1000000000, 4}, /* want */ {50847534, false}},
+      {"pi(10^10)", /* in */ {10000000000ULL, 0}, /* want */ {455052511, false}},
+      {"pi(10^11) on four threads", /* in */ {100000000000ULL, 4}, /* want */ {4118054813ULL, false}},
+      {"limit: past 2^62", /* in */ {(std::uint64_t{1} << 62) + 1, 0}, /* want */ {0, true}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(foo.prime_pi(tc.in.x, tc.in.threads), std::invalid_argument);
+    }
+    else
+    {
+      auto got = foo.prime_pi(tc.in.x, tc.in.threads);
+      EXPECT_EQ(got, tc.want.result);
+    }
+  }
+}
+
+TEST(FooTest, PrimePiMatchesCountPrimes)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::uint64_t x;
+    } in;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"every x below 1000", /* in */ {1000}},
+      {"x just below a prime square", /* in */ {10200}},
+      {"x a large prime", /* in */ {99999989}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+    const std::uint64_t first = tc.in.x > 1000 ? tc.in.x : 0;
+
+    // Act & Assert
+    for (std::uint64_t x = first; x <= tc.in.x; ++x)
+    {
+      EXPECT_EQ(foo.prime_pi(x, 1), foo.count_primes(0, x + 1, 1)) << "x = " << x;
+    }
+  }
+}
+
+TEST(FooTest, Factorize)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::uint64_t n;
+    } in;
+
+    struct Want
+    {
+      std::vector<std::uint64_t> result;
+      bool throws_exception;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"zero", /* in */ {0}, /* want */ {{}, true}},
+      {"one", /* in */ {1}, /* want */ {{}, false}},
+      {"two", /* in */ {2}, /* want */ {{2}, false}},
+      {"small composite", /* in */ {360}, /* want */ {{2, 2, 2, 3, 3, 5}, false}},
+      {"power of two", /* in */ {std::uint64_t{1} << 63}, /* want */ {{std::vector<std::uint64_t>(63, 2)}, false}},
+      {"largest trial prime", /* in */ {1021}, /* want */ {{1021}, false}},
+      {"first prime past trial division", /* in */ {1031}, /* want */ {{1031}, false}},
+      {"carmichael number", /* in */ {3215031751ULL}, /* want */ {{151, 751, 28351}, false}},
+      {"square of a prime past trial division", /* in */ {1031 * 1031}, /* want */ {{1031, 1031}, false}},
+      {"three mid-sized primes", /* in */ {1000003ULL * 1000033 * 1009}, /* want */ {{1009, 1000003, 1000033}, false}},
+      {"cube of a 21-bit prime", /* in */ {1048573ULL * 1048573 * 1048573}, /* want */ {{1048573, 1048573, 1048573}, false}},
+      {"balanced 64-bit semiprime", /* in */ {4294967279ULL * 4294967291ULL}, /* want */ {{4294967279ULL, 4294967291ULL}, false}},
+      {"square of the largest 32-bit prime", /* in */ {4294967291ULL * 4294967291ULL}, /* want */ {{4294967291ULL, 4294967291ULL}, false}},
+      {"largest 64-bit prime", /* in */ {18446744073709551557ULL}, /* want */ {{18446744073709551557ULL}, false}},
+      {"largest 64-bit integer", /* in */ {18446744073709551615ULL}, /* want */ {{3, 5, 17, 257, 641, 65537, 6700417}, false}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(foo.factorize(tc.in.n), std::invalid_argument);
+    }
+    else
+    {
+      auto got = foo.factorize(tc.in.n);
+      EXPECT_EQ(got, tc.want.result);
+    }
+  }
+}
+
+TEST(FooTest, FactorizeMatchesIsPrime)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      int bits;
+      std::size_t count;
+    } in;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"random 20-bit integers", /* in */ {20, 10000}},
+      {"random 40-bit integers", /* in */ {40, 2000}},
+      {"random 64-bit integers", /* in */ {64, 500}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+    std::mt19937_64 engine(7);
+
+    for (std::size_t i = 0; i < tc.in.count; ++i)
+    {
+      const std::uint64_t n = (engine() >> (64 - tc.in.bits)) | 1;
+
+      // Act
+      auto got = foo.factorize(n);
+
+      // Assert
+      std::uint64_t product = 1;
+      for (const auto p : got)
+      {
+        EXPECT_TRUE(foo.is_prime(p)) << p << " in the factors of " << n;
+        product *= p;
+      }
+      EXPECT_EQ(product, n);
+      EXPECT_TRUE(std::is_sorted(got.begin(), got.end()));
+    }
+  }
+}
+
+TEST(FooTest, FactorizeBatch)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::vector<std::uint64_t> values;
+      unsigned threads;
+    } in;
+
+    struct Want
+    {
+      bool throws_exception;
+    } want;
+  };
+
+  std::vector<std::uint64_t> many(1000);
+  std::iota(many.begin(), many.end(), std::uint64_t{4294967000ULL * 4294967000ULL});
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"empty span", /* in */ {{}, 0}, /* want */ {false}},
+      {"one value", /* in */ {{360}, 1}, /* want */ {false}},
+      {"many values on one thread", /* in */ {many, 1}, /* want */ {false}},
+      {"many values on four threads", /* in */ {many, 4}, /* want */ {false}},
+      {"zero among the values", /* in */ {{6, 0, 10}, 4}, /* want */ {true}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(foo.factorize(tc.in.values, tc.in.threads), std::invalid_argument);
+      continue;
+    }
+
+    auto got = foo.factorize(tc.in.values, tc.in.threads);
+    ASSERT_EQ(got.size(), tc.in.values.size());
+    for (std::size_t i = 0; i < got.size(); ++i)
+    {
+      EXPECT_EQ(got[i], foo.factorize(tc.in.values[i]));
+    }
+  }
+}
+
+TEST(FooTest, ForEachPrime)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::uint64_t first;
+      std::uint64_t last;
+      unsigned threads;
+    } in;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"many segments on one thread", /* in */ {0, 20000000, 1}},
+      {"many segments on four threads", /* in */ {0, 20000000, 4}},
+      {"window near 10^12", /* in */ {1000000000000ULL - 50000, 1000000000000ULL + 50000, 4}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+    std::vector<std::uint64_t> got;
+    std::size_t calls = 0;
+    const auto caller = std::this_thread::get_id();
+
+    // Act
+    foo.for_each_prime(
+        tc.in.first, tc.in.last,
+        [&](std::span<const std::uint64_t> run)
+        {
+          ++calls;
+          EXPECT_EQ(std::this_thread::get_id(), caller);
+          EXPECT_FALSE(run.empty());
+          got.insert(got.end(), run.begin(), run.end());
+        },
+        tc.in.threads);
+
+    // Assert
+    EXPECT_TRUE(std::is_sorted(got.begin(), got.end()));
+    EXPECT_EQ(std::adjacent_find(got.begin(), got.end()), got.end());
+    EXPECT_EQ(got.size(), foo.count_primes(tc.in.first, tc.in.last, tc.in.threads));
+    EXPECT_GT(calls, 0U);
+    if (tc.in.last - tc.in.first <= 100000)
+    {
+      std::vector<std::uint64_t> want;
+      for (std::uint64_t n = tc.in.first; n < tc.in.last; ++n)
+      {
+        if (foo.is_prime(n))
+        {
+          want.push_back(n);
+        }
+      }
+      EXPECT_EQ(got, want);
+    }
+  }
+}
+
+TEST(FooTest, ForEachPrimeCallbackThrows)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::uint64_t first;
+      unsigned threads;
+      std::size_t throw_on;
+    } in;
+
+    struct Want
+    {
+      std::size_t calls;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"throw on the wheel primes", /* in */ {0, 1, 1}, /* want */ {1}},
+      {"throw on the first run", /* in */ {1000, 4, 1}, /* want */ {1}},
+      {"throw on a later round on two threads", /* in */ {1000, 2, 5}, /* want */ {5}},
+      {"throw on a later round on four threads", /* in */ {1000, 4, 9}, /* want */ {9}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+    std::size_t calls = 0;
+    auto callback = [&](std::span<const std::uint64_t>)
+    {
+      if (++calls == tc.in.throw_on)
+      {
+        throw std::runtime_error("stop");
+      }
+    };
+
+    // Act & Assert
+    EXPECT_THROW(foo.for_each_prime(tc.in.first, 100000000, callback, tc.in.threads), std::runtime_error);
+    EXPECT_EQ(calls, tc.want.calls);
+  }
+}
+
+TEST(FooTest, Greet)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::string text;
+    } in;
+
+    struct Want
+    {
+      std::string result;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"empty string", /* in */ {""}, /* want */ {"Hello, !"}},
+      {"single word", /* in */ {"World"}, /* want */ {"Hello, World!"}},
+      {"multiple words", /* in */ {"C++ Developer"}, /* want */ {"Hello, C++ Developer!"}},
+      {"with special characters", /* in */ {"Hello, World!"}, /* want */ {"Hello, Hello, World!!"}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+
+    // Act
+    auto got = foo.greet(tc.in.text);
+
+    // Assert
+    EXPECT_EQ(got, tc.want.result);
+  }
+}
+
+TEST(FooTest, FindMax)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::vector<int> vec;
+    } in;
+
+    struct Want
+    {
+      int result;
+      bool throws_exception;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"single element", /* in */ {{5}}, /* want */ {5, false}},
+      {"positive numbers", /* in */ {{1, 3, 2, 5, 4}}, /* want */ {5, false}},
+      {"negative numbers", /* in */ {{-5, -3, -8, -1}}, /* want */ {-1, false}},
+      {"mixed numbers", /* in */ {{-2, 0, 3, -1, 2}}, /* want */ {3, false}},
+      {"duplicates", /* in */ {{2, 2, 2}}, /* want */ {2, false}},
+      {"empty vector", /* in */ {{}}, /* want */ {0, true}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(foo.find_max(tc.in.vec), std::invalid_argument);
+    }
+    else
+    {
+      auto got = foo.find_max(tc.in.vec);
+      EXPECT_EQ(got, tc.want.result);
+    }
+  }
+}
+
+TEST(FooTest, FindMaxSpan)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::vector<int> values;
+    } in;
+
+    struct Want
+    {
+      int result;
+      bool throws_exception;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"single element", /* in */ {{5}}, /* want */ {5, false}},
+      {"negative numbers", /* in */ {{-5, -3, -8, -1}}, /* want */ {-1, false}},
+      {"maximum in vector body",
+       /* in */ {{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 99, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, -1}},
+       /* want */ {99, false}},
+      {"maximum in tail", /* in */ {{INT_MIN, INT_MIN, INT_MIN, INT_MIN, INT_MIN, INT_MIN, INT_MIN, INT_MIN, INT_MIN, INT_MAX}}, /* want */ {INT_MAX, false}},
+      {"boundary: all int min", /* in */ {{INT_MIN, INT_MIN, INT_MIN}}, /* want */ {INT_MIN, false}},
+      {"empty span", /* in */ {{}}, /* want */ {0, true}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+    std::span<const int> values(tc.in.values);
+
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(foo.find_max(values), std::invalid_argument);
+      EXPECT_THROW(foo.find_max_parallel(values), std::invalid_argument);
+    }
+    else
+    {
+      EXPECT_EQ(foo.find_max(values), tc.want.result);
+      EXPECT_EQ(foo.find_max_parallel(values), tc.want.result);
+    }
+  }
+}
+
+TEST(FooTest, Argmax)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::vector<int> values;
+    } in;
+
+    struct Want
+    {
+      std::size_t result;
+      bool throws_exception;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"single element", /* in */ {{5}}, /* want */ {0, false}},
+      {"positive numbers", /* in */ {{1, 3, 2, 5, 4}}, /* want */ {3, false}},
+      {"first of duplicates", /* in */ {{2, 7, 1, 7, 7}}, /* want */ {1, false}},
+      {"boundary: all int min", /* in */ {{INT_MIN, INT_MIN, INT_MIN}}, /* want */ {0, false}},
+      {"empty span", /* in */ {{}}, /* want */ {0, true}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(foo.argmax(tc.in.values), std::invalid_argument);
+      EXPECT_THROW(foo.argmax_parallel(tc.in.values), std::invalid_argument);
+    }
+    else
+    {
+      EXPECT_EQ(foo.argmax(tc.in.values), tc.want.result);
+      EXPECT_EQ(foo.argmax_parallel(tc.in.values), tc.want.result);
+    }
+  }
+}
+
+TEST(FooTest, ArgmaxParallel)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::size_t size;
+      std::vector<std::size_t> peaks;
+      unsigned threads;
+    } in;
+
+    struct Want
+    {
+      std::size_t result;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"peak in first chunk", /* in */ {1 << 20, {10}, 4}, /* want */ {10}},
+      {"peak in last chunk", /* in */ {1 << 20, {(1 << 20) - 1}, 4}, /* want */ {(1 << 20) - 1}},
+      {"tie across chunks", /* in */ {1 << 20, {(1 << 20) - 5, 300000, 700000}, 4}, /* want */ {300000}},
+      {"single thread", /* in */ {1 << 20, {123456, 654321}, 1}, /* want */ {123456}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+    std::vector<int> values(tc.in.size);
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+      values[i] = static_cast<int>(i % 1000);
+    }
+    for (auto peak : tc.in.peaks)
+    {
+      values[peak] = INT_MAX;
+    }
+
+    // Act
+    auto index = foo.argmax_parallel(values, tc.in.threads);
+    auto max = foo.find_max_parallel(values, tc.in.threads);
+
+    // Assert
+    EXPECT_EQ(index, tc.want.result);
+    EXPECT_EQ(index, foo.argmax(values));
+    EXPECT_EQ(max, INT_MAX);
+  }
+}
+
+TEST(FooTest, FindTopK)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::vector<int> values;
+      std::size_t k;
+    } in;
+
+    struct Want
+    {
+      std::vector<int> result;
+    } want;
+  };
+
+  // A vector body of 64 lanes plus a scalar tail, with its largest values spread across both
+  std::vector<int> block(70);
+  for (std::size_t i = 0; i < block.size(); ++i)
+  {
+    block[i] = static_cast<int>((i * 37) % 70) - 35;
+  }
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"k zero", /* in */ {{3, 1, 2}, 0}, /* want */ {{}}},
+      {"empty span", /* in */ {{}, 3}, /* want */ {{}}},
+      {"k one", /* in */ {{3, 9, 2}, 1}, /* want */ {{9}}},
+      {"k below size", /* in */ {{5, 1, 4, 2, 3}, 3}, /* want */ {{5, 4, 3}}},
+      {"k equal to size", /* in */ {{2, -1, 7}, 3}, /* want */ {{7, 2, -1}}},
+      {"k above size", /* in */ {{2, -1, 7}, 10}, /* want */ {{7, 2, -1}}},
+      {"duplicates", /* in */ {{4, 4, 1, 4, 3}, 2}, /* want */ {{4, 4}}},
+      {"negative numbers", /* in */ {{-5, -1, -3, -2}, 2}, /* want */ {{-1, -2}}},
+      {"boundary: int limits", /* in */ {{INT_MIN, INT_MAX, 0, INT_MIN}, 2}, /* want */ {{INT_MAX, 0}}},
+      {"vector body and tail", /* in */ {block, 4}, /* want */ {{34, 33, 32, 31}}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+
+    // Act
+    auto got = foo.find_top_k(tc.in.values, tc.in.k);
+
+    // Assert
+    EXPECT_EQ(got, tc.want.result);
+  }
+}
+
+TEST(FooTest, FindTopKParallel)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::size_t size;
+      std::size_t k;
+      unsigned threads;
+    } in;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"small input on one thread", /* in */ {1000, 10, 4}},
+      {"k of one", /* in */ {1 << 20, 1, 4}},
+      {"top hundred", /* in */ {1 << 20, 100, 4}},
+      {"k above chunk size", /* in */ {1 << 18, 1 << 17, 4}},
+      {"single thread", /* in */ {1 << 20, 100, 1}},
+      {"k above size, more threads than cores", /* in */ {1 << 21, std::size_t{1} << 40, 32}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+    std::vector<int> values(tc.in.size);
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+      values[i] = static_cast<int>(static_cast<unsigned>(i) * 2654435761U);
+    }
+    std::vector<int> want(values);
+    std::sort(want.begin(), want.end(), std::greater<>{});
+    want.resize(std::min(tc.in.k, want.size()));
+
+    // Act
+    auto got = foo.find_top_k_parallel(values, tc.in.k, tc.in.threads);
+
+    // Assert
+    EXPECT_EQ(got, want);
+    EXPECT_EQ(got, foo.find_top_k(values, tc.in.k));
+  }
+}
+
+TEST(FooTest, Summarize)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::vector<int> values;
+      std::size_t offset;
+    } in;
+
+    struct Want
+    {
+      Summary result;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"empty span", /* in */ {{}, 0}, /* want */ {{INT_MAX, INT_MIN, 0, 0, 0, 0}}},
+      {"single element", /* in */ {{5}, 0}, /* want */ {{5, 5, 0, 0, 5, 1}}},
+      {"first of duplicates", /* in */ {{3, -1, 7, -1, 7}, 0}, /* want */ {{-1, 7, 1, 2, 15, 5}}},
+      {"offset indices", /* in */ {{3, -1, 7}, 100}, /* want */ {{-1, 7, 101, 102, 9, 3}}},
+      {"widened sum", /* in */ {{INT_MAX, INT_MAX, INT_MAX, INT_MAX, INT_MAX, INT_MAX, INT_MAX, INT_MAX, INT_MIN}, 0},
+       /* want */ {{INT_MIN, INT_MAX, 8, 0, 8LL * INT_MAX + INT_MIN, 9}}},
+      {"vector body and tail",
+       /* in */ {{9, 8, 7, 6, 5, 4, 3, 2, 1, 0, -1, -2, -3, -4, -5, -6, -7, -8, -9}, 0},
+       /* want */ {{-9, 9, 18, 0, 0, 19}}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+
+    // Act
+    auto got = foo.summarize(tc.in.values, tc.in.offset);
+
+    // Assert
+    EXPECT_EQ(got.min, tc.want.result.min);
+    EXPECT_EQ(got.max, tc.want.result.max);
+    EXPECT_EQ(got.argmin, tc.want.result.argmin);
+    EXPECT_EQ(got.argmax, tc.want.result.argmax);
+    EXPECT_EQ(got.sum, tc.want.result.sum);
+    EXPECT_EQ(got.count, tc.want.result.count);
+  }
+}
+
+TEST(FooTest, SummarizeMerge)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::size_t size;
+      std::size_t split;
+      unsigned threads;
+    } in;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"small input", /* in */ {100, 37, 2}},
+      {"split at block boundary", /* in */ {10000, 2048, 3}},
+      {"parallel chunks", /* in */ {1 << 20, 500000, 4}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+    std::vector<int> values(tc.in.size);
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+      values[i] = static_cast<int>((i * 2654435761U) % 20001) - 10000;
+    }
+    std::span<const int> all(values);
+    auto want = foo.summarize(all);
+
+    // Act
+    auto merged = foo.summarize(all.subspan(tc.in.split), tc.in.split);
+    merged.merge(foo.summarize(all.first(tc.in.split)));
+    auto parallel = foo.summarize_parallel(all, tc.in.threads);
+
+    // Assert
+    for (const auto &got : {merged, parallel})
+    {
+      EXPECT_EQ(got.min, want.min);
+      EXPECT_EQ(got.max, want.max);
+      EXPECT_EQ(got.argmin, want.argmin);
+      EXPECT_EQ(got.argmax, want.argmax);
+      EXPECT_EQ(got.sum, want.sum);
+      EXPECT_EQ(got.count, want.count);
     }
+    EXPECT_EQ(values[want.argmin], want.min);
+    EXPECT_EQ(values[want.argmax], want.max);
+    EXPECT_DOUBLE_EQ(want.mean(), static_cast<double>(want.sum) / static_cast<double>(want.count));
   }
 }
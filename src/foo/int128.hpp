@@ -0,0 +1,26 @@
+#pragma once
+
+/**
+ * @file foo/int128.hpp
+ * @brief The 128-bit integer alias shared by the foo library.
+ *
+ * This header is an implementation detail of the foo library. It names the
+ * compiler's built-in 128-bit integer once, so the wide Foo overloads, the
+ * modular helpers and BigInt all agree on one type.
+ *
+ * @author Sentenz
+ * @copyright Copyright (c) 2026 Sentenz
+ * @license SPDX-License-Identifier: Apache-2.0
+ */
+
+namespace cpp_concept
+{
+
+  /**
+   * @brief Unsigned 128-bit integer used by the wide Foo overloads.
+   *
+   * @note __int128 is a GCC/Clang extension; the marker keeps -Wpedantic quiet.
+   */
+  __extension__ typedef unsigned __int128 uint128_t;
+
+} // namespace cpp_concept
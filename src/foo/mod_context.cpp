@@ -0,0 +1,441 @@
+#include "foo/mod_context.hpp"
+#include "foo/modular.hpp"
+#include "foo/simd.hpp"
+
+#include <bit>
+#include <cstddef>
+#include <stdexcept>
+
+namespace cpp_concept
+{
+
+  namespace
+  {
+
+    enum class Op
+    {
+      add,
+      multiply,
+      multiply_add
+    };
+
+    // Moduli below 2^32 keep every product of two reduced values within a
+    // 64-bit lane
+    constexpr std::uint64_t lane_limit = std::uint64_t{1} << 32;
+
+    // Reduction constants unpacked into the form every kernel consumes. The
+    // vector kernels run 32-bit Montgomery arithmetic, x * 2^32 mod m, on one
+    // value per 64-bit lane; their constants are the low half of inverse, r
+    // as 2^64 = (2^32)^2 and r32 as 1 in that form
+    struct Params
+    {
+      std::uint64_t modulus;
+      std::uint64_t inverse; // m^-1 mod 2^64, for odd m only
+      std::uint64_t r;       // 2^64 mod m
+      std::uint64_t r2;      // 2^128 mod m
+      std::uint64_t r32;     // 2^32 mod m
+
+      // The vector kernels need an odd modulus below 2^32 for products; sums
+      // only need the modulus to fit
+      bool vectorizable(bool needs_odd) const noexcept
+      {
+        return modulus < lane_limit && (!needs_odd || (modulus & 1) != 0);
+      }
+    };
+
+    template <Op op>
+    void kernel_scalar(const ModContext &mod, const std::uint64_t *a, const std::uint64_t *b, const std::uint64_t *c,
+                       std::uint64_t *out, std::size_t first, std::size_t n)
+    {
+      for (std::size_t i = first; i < n; ++i)
+      {
+        if constexpr (op == Op::add)
+        {
+          out[i] = mod.add(a[i], b[i]);
+        }
+        else if constexpr (op == Op::multiply)
+        {
+          out[i] = mod.multiply(a[i], b[i]);
+        }
+        else
+        {
+          out[i] = mod.add(mod.multiply(a[i], b[i]), c[i]);
+        }
+      }
+    }
+
+    // Odd moduli without a vector kernel: two Montgomery reductions per product, the
+    // second cancelling the 2^-64 the first leaves behind, undercut the
+    // reciprocal division of the scalar path
+    template <Op op>
+    void kernel_montgomery(const ModContext &mod, const Params &p, const std::uint64_t *a, const std::uint64_t *b,
+                           const std::uint64_t *c, std::uint64_t *out, std::size_t n)
+    {
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        const std::uint64_t t = modular::montgomery_reduce(uint128_t{a[i]} * b[i], p.modulus, p.inverse);
+        const std::uint64_t product = modular::montgomery_reduce(uint128_t{t} * p.r2, p.modulus, p.inverse);
+        if constexpr (op == Op::multiply)
+        {
+          out[i] = product;
+        }
+        else
+        {
+          out[i] = mod.add(product, c[i]);
+        }
+      }
+    }
+
+    void power_scalar(const ModContext &mod, const std::uint64_t *bases, std::uint64_t exponent, std::uint64_t *out,
+                      std::size_t first, std::size_t n)
+    {
+      for (std::size_t i = first; i < n; ++i)
+      {
+        out[i] = mod.power(bases[i], exponent);
+      }
+    }
+
+#if CPP_CONCEPT_SIMD_X86
+    // x * 2^-32 mod m for x < m * 2^32. The low halves of x and q * m agree by
+    // construction of q, so the quotient is a difference of high halves, and
+    // the sign of the difference selects the correction
+    CPP_CONCEPT_TARGET("avx2")
+    __m256i reduce_avx2(__m256i x, __m256i m, __m256i inverse)
+    {
+      const __m256i q = _mm256_mul_epu32(x, inverse);
+      const __m256i qm = _mm256_mul_epu32(q, m);
+      const __m256i d = _mm256_sub_epi64(_mm256_srli_epi64(x, 32), _mm256_srli_epi64(qm, 32));
+      return _mm256_add_epi64(d, _mm256_and_si256(m, _mm256_cmpgt_epi64(_mm256_setzero_si256(), d)));
+    }
+
+    // (a + b) mod m for a, b < m < 2^32, whose sum cannot leave the lane
+    CPP_CONCEPT_TARGET("avx2")
+    __m256i add_avx2(__m256i a, __m256i b, __m256i m)
+    {
+      const __m256i d = _mm256_sub_epi64(_mm256_add_epi64(a, b), m);
+      return _mm256_add_epi64(d, _mm256_and_si256(m, _mm256_cmpgt_epi64(_mm256_setzero_si256(), d)));
+    }
+
+    // Two reductions: the first leaves a * b * 2^-32, the product with
+    // 2^64 mod m cancels the stray factor
+    CPP_CONCEPT_TARGET("avx2")
+    __m256i multiply_avx2(__m256i a, __m256i b, __m256i m, __m256i inverse, __m256i r2)
+    {
+      return reduce_avx2(_mm256_mul_epu32(reduce_avx2(_mm256_mul_epu32(a, b), m, inverse), r2), m, inverse);
+    }
+
+    template <Op op>
+    CPP_CONCEPT_TARGET("avx2")
+    void kernel_avx2(const ModContext &mod, const Params &p, const std::uint64_t *a, const std::uint64_t *b,
+                     const std::uint64_t *c, std::uint64_t *out, std::size_t n)
+    {
+      const __m256i m = _mm256_set1_epi64x(static_cast<long long>(p.modulus));
+      const __m256i inverse = _mm256_set1_epi64x(static_cast<long long>(p.inverse));
+      const __m256i r2 = _mm256_set1_epi64x(static_cast<long long>(p.r));
+
+      std::size_t i = 0;
+      for (; i + 4 <= n; i += 4)
+      {
+        const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+        const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+        __m256i vr;
+
+        if constexpr (op == Op::add)
+        {
+          vr = add_avx2(va, vb, m);
+        }
+        else if constexpr (op == Op::multiply)
+        {
+          vr = multiply_avx2(va, vb, m, inverse, r2);
+        }
+        else
+        {
+          const __m256i vc = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(c + i));
+          vr = add_avx2(multiply_avx2(va, vb, m, inverse, r2), vc, m);
+        }
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i), vr);
+      }
+
+      kernel_scalar<op>(mod, a, b, c, out, i, n);
+    }
+
+    CPP_CONCEPT_TARGET("avx2")
+    void power_avx2(const ModContext &mod, const Params &p, const std::uint64_t *bases, std::uint64_t exponent,
+                    std::uint64_t *out, std::size_t n)
+    {
+      const __m256i m = _mm256_set1_epi64x(static_cast<long long>(p.modulus));
+      const __m256i inverse = _mm256_set1_epi64x(static_cast<long long>(p.inverse));
+      const __m256i r2 = _mm256_set1_epi64x(static_cast<long long>(p.r));
+      const __m256i one = _mm256_set1_epi64x(static_cast<long long>(p.r32));
+
+      std::size_t i = 0;
+      for (; i + 4 <= n; i += 4)
+      {
+        // Every lane shares the exponent, so the square-and-multiply ladder
+        // runs in lockstep without per-lane branches
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(bases + i));
+        x = reduce_avx2(_mm256_mul_epu32(x, r2), m, inverse);
+        __m256i result = one;
+        for (std::uint64_t e = exponent; e != 0; e >>= 1)
+        {
+          if (e & 1)
+          {
+            result = reduce_avx2(_mm256_mul_epu32(result, x), m, inverse);
+          }
+          x = reduce_avx2(_mm256_mul_epu32(x, x), m, inverse);
+        }
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i), reduce_avx2(result, m, inverse));
+      }
+
+      power_scalar(mod, bases, exponent, out, i, n);
+    }
+
+    CPP_CONCEPT_AVX512_BEGIN
+    CPP_CONCEPT_TARGET("avx512f")
+    __m512i reduce_avx512(__m512i x, __m512i m, __m512i inverse)
+    {
+      const __m512i q = _mm512_mul_epu32(x, inverse);
+      const __m512i qm = _mm512_mul_epu32(q, m);
+      const __m512i d = _mm512_sub_epi64(_mm512_srli_epi64(x, 32), _mm512_srli_epi64(qm, 32));
+      return _mm512_mask_add_epi64(d, _mm512_cmplt_epi64_mask(d, _mm512_setzero_si512()), d, m);
+    }
+
+    CPP_CONCEPT_TARGET("avx512f")
+    __m512i add_avx512(__m512i a, __m512i b, __m512i m)
+    {
+      const __m512i d = _mm512_sub_epi64(_mm512_add_epi64(a, b), m);
+      return _mm512_mask_add_epi64(d, _mm512_cmplt_epi64_mask(d, _mm512_setzero_si512()), d, m);
+    }
+
+    CPP_CONCEPT_TARGET("avx512f")
+    __m512i multiply_avx512(__m512i a, __m512i b, __m512i m, __m512i inverse, __m512i r2)
+    {
+      return reduce_avx512(_mm512_mul_epu32(reduce_avx512(_mm512_mul_epu32(a, b), m, inverse), r2), m, inverse);
+    }
+
+    template <Op op>
+    CPP_CONCEPT_TARGET("avx512f")
+    void kernel_avx512(const ModContext &mod, const Params &p, const std::uint64_t *a, const std::uint64_t *b,
+                       const std::uint64_t *c, std::uint64_t *out, std::size_t n)
+    {
+      const __m512i m = _mm512_set1_epi64(static_cast<long long>(p.modulus));
+      const __m512i inverse = _mm512_set1_epi64(static_cast<long long>(p.inverse));
+      const __m512i r2 = _mm512_set1_epi64(static_cast<long long>(p.r));
+
+      std::size_t i = 0;
+      for (; i + 8 <= n; i += 8)
+      {
+        const __m512i va = _mm512_loadu_si512(a + i);
+        const __m512i vb = _mm512_loadu_si512(b + i);
+        __m512i vr;
+
+        if constexpr (op == Op::add)
+        {
+          vr = add_avx512(va, vb, m);
+        }
+        else if constexpr (op == Op::multiply)
+        {
+          vr = multiply_avx512(va, vb, m, inverse, r2);
+        }
+        else
+        {
+          vr = add_avx512(multiply_avx512(va, vb, m, inverse, r2), _mm512_loadu_si512(c + i), m);
+        }
+
+        _mm512_storeu_si512(out + i, vr);
+      }
+
+      kernel_scalar<op>(mod, a, b, c, out, i, n);
+    }
+
+    CPP_CONCEPT_TARGET("avx512f")
+    void power_avx512(const ModContext &mod, const Params &p, const std::uint64_t *bases, std::uint64_t exponent,
+                      std::uint64_t *out, std::size_t n)
+    {
+      const __m512i m = _mm512_set1_epi64(static_cast<long long>(p.modulus));
+      const __m512i inverse = _mm512_set1_epi64(static_cast<long long>(p.inverse));
+      const __m512i r2 = _mm512_set1_epi64(static_cast<long long>(p.r));
+      const __m512i one = _mm512_set1_epi64(static_cast<long long>(p.r32));
+
+      std::size_t i = 0;
+      for (; i + 8 <= n; i += 8)
+      {
+        __m512i x = reduce_avx512(_mm512_mul_epu32(_mm512_loadu_si512(bases + i), r2), m, inverse);
+        __m512i result = one;
+        for (std::uint64_t e = exponent; e != 0; e >>= 1)
+        {
+          if (e & 1)
+          {
+            result = reduce_avx512(_mm512_mul_epu32(result, x), m, inverse);
+          }
+          x = reduce_avx512(_mm512_mul_epu32(x, x), m, inverse);
+        }
+
+        _mm512_storeu_si512(out + i, reduce_avx512(result, m, inverse));
+      }
+
+      power_scalar(mod, bases, exponent, out, i, n);
+    }
+    CPP_CONCEPT_AVX512_END
+#endif
+
+    template <Op op>
+    void batch(const ModContext &mod, const Params &p, std::span<const std::uint64_t> a, std::span<const std::uint64_t> b,
+               std::span<const std::uint64_t> c, std::span<std::uint64_t> out)
+    {
+      if (a.size() != b.size() || a.size() != out.size() || (op == Op::multiply_add && c.size() != out.size()))
+      {
+        throw std::invalid_argument("Span sizes must match");
+      }
+
+      const std::size_t n = out.size();
+
+#if CPP_CONCEPT_SIMD_X86
+      if (p.vectorizable(op != Op::add))
+      {
+        // NOTE Two 64-bit lanes of SSE2 do not beat the scalar reduction,
+        // so SSE2 hosts take the scalar path
+        switch (simd::isa())
+        {
+        case simd::Isa::avx512:
+          kernel_avx512<op>(mod, p, a.data(), b.data(), c.data(), out.data(), n);
+          return;
+        case simd::Isa::avx2:
+          kernel_avx2<op>(mod, p, a.data(), b.data(), c.data(), out.data(), n);
+          return;
+        case simd::Isa::sse2:
+        case simd::Isa::scalar:
+          break;
+        }
+      }
+#endif
+
+      if constexpr (op != Op::add)
+      {
+        if ((p.modulus & 1) != 0)
+        {
+          kernel_montgomery<op>(mod, p, a.data(), b.data(), c.data(), out.data(), n);
+          return;
+        }
+      }
+
+      kernel_scalar<op>(mod, a.data(), b.data(), c.data(), out.data(), 0, n);
+    }
+
+  } // namespace
+
+  ModContext::ModContext(std::uint64_t modulus)
+      : modulus_(modulus)
+  {
+    if (modulus < 2)
+    {
+      throw std::invalid_argument("Modulus must be at least 2");
+    }
+
+    // The quotient lies in [2^64, 2^65), so the cast drops exactly the 2^64
+    shift_ = static_cast<unsigned>(std::countl_zero(modulus));
+    normalized_ = modulus << shift_;
+    reciprocal_ = static_cast<std::uint64_t>(~uint128_t{0} / normalized_);
+
+    r_ = (0 - modulus) % modulus;
+    r32_ = (std::uint64_t{1} << 32) % modulus;
+    r2_ = static_cast<std::uint64_t>(uint128_t{r_} * r_ % modulus);
+    if ((modulus & 1) != 0)
+    {
+      inverse_ = modular::Montgomery(modulus).inverse();
+    }
+  }
+
+  std::uint64_t ModContext::add(std::uint64_t a, std::uint64_t b) const noexcept
+  {
+    return modular::add_mod(a, b, modulus_);
+  }
+
+  std::uint64_t ModContext::power(std::uint64_t base, std::uint64_t exponent) const noexcept
+  {
+    base = reduce(base);
+
+    if ((modulus_ & 1) == 0)
+    {
+      std::uint64_t result = 1;
+      for (; exponent != 0; exponent >>= 1)
+      {
+        if (exponent & 1)
+        {
+          result = multiply(result, base);
+        }
+        base = multiply(base, base);
+      }
+
+      return result;
+    }
+
+    // Odd moduli run in Montgomery form, which pays the conversion once per power
+    // instead of a reciprocal division per product
+    std::uint64_t x = modular::montgomery_reduce(uint128_t{base} * r2_, modulus_, inverse_);
+    std::uint64_t result = r_;
+    for (; exponent != 0; exponent >>= 1)
+    {
+      if (exponent & 1)
+      {
+        result = modular::montgomery_reduce(uint128_t{result} * x, modulus_, inverse_);
+      }
+      x = modular::montgomery_reduce(uint128_t{x} * x, modulus_, inverse_);
+    }
+
+    return modular::montgomery_reduce(result, modulus_, inverse_);
+  }
+
+  void ModContext::add(std::span<const std::uint64_t> a, std::span<const std::uint64_t> b,
+                       std::span<std::uint64_t> out) const
+  {
+    batch<Op::add>(*this, {modulus_, inverse_, r_, r2_, r32_}, a, b, {}, out);
+  }
+
+  void ModContext::multiply(std::span<const std::uint64_t> a, std::span<const std::uint64_t> b,
+                            std::span<std::uint64_t> out) const
+  {
+    batch<Op::multiply>(*this, {modulus_, inverse_, r_, r2_, r32_}, a, b, {}, out);
+  }
+
+  void ModContext::multiply_add(std::span<const std::uint64_t> a, std::span<const std::uint64_t> b,
+                                std::span<const std::uint64_t> c, std::span<std::uint64_t> out) const
+  {
+    batch<Op::multiply_add>(*this, {modulus_, inverse_, r_, r2_, r32_}, a, b, c, out);
+  }
+
+  void ModContext::power(std::span<const std::uint64_t> bases, std::uint64_t exponent,
+                         std::span<std::uint64_t> out) const
+  {
+    if (bases.size() != out.size())
+    {
+      throw std::invalid_argument("Span sizes must match");
+    }
+
+    const std::size_t n = out.size();
+
+#if CPP_CONCEPT_SIMD_X86
+    const Params p{modulus_, inverse_, r_, r2_, r32_};
+    if (p.vectorizable(true))
+    {
+      switch (simd::isa())
+      {
+      case simd::Isa::avx512:
+        power_avx512(*this, p, bases.data(), exponent, out.data(), n);
+        return;
+      case simd::Isa::avx2:
+        power_avx2(*this, p, bases.data(), exponent, out.data(), n);
+        return;
+      case simd::Isa::sse2:
+      case simd::Isa::scalar:
+        break;
+      }
+    }
+#endif
+
+    power_scalar(*this, bases.data(), exponent, out.data(), 0, n);
+  }
+
+} // namespace cpp_concept
@@ -0,0 +1,227 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+#include "foo/fixed_int.hpp"
+
+/**
+ * @file foo/mod_context.hpp
+ * @brief Header file for the ModContext class providing division-free modular arithmetic.
+ *
+ * This file defines the ModContext class within the cpp_concept namespace. A
+ * ModContext precomputes the Barrett and Montgomery constants of a fixed
+ * modulus once, so the sums, products and powers that follow never reach the
+ * hardware integer divide.
+ *
+ * @author Sentenz
+ * @copyright Copyright (c) 2026 Sentenz
+ * @license SPDX-License-Identifier: Apache-2.0
+ */
+
+namespace cpp_concept
+{
+
+  /**
+   * @brief Modular addition, multiplication and exponentiation for a fixed modulus.
+   *
+   * The constructor pays the only divisions. Scalar products are reduced
+   * Barrett-style against a precomputed reciprocal of the modulus, in the
+   * normalized form of Moller and Granlund: one widening multiply, one low
+   * multiply and two corrections, for any modulus. Odd moduli also get
+   * Montgomery constants: powers run in Montgomery form, where the conversion
+   * is paid once per power instead of once per product, and so do the span
+   * kernels. For odd moduli below \f$2^{32}\f$ those hold one value per
+   * 64-bit lane and reduce with 32-bit Montgomery multiplication in AVX2 or
+   * AVX-512.
+   *
+   * @note Thread safety: A ModContext is immutable after construction and safe
+   *       for concurrent read-only access from multiple threads.
+   *
+   * @see Foo::multiply()
+   * @see Divider
+   *
+   * @code
+   * ModContext mod(998244353);
+   * std::uint64_t p = mod.multiply(123456789, 987654321);  // Returns 263684735
+   * std::uint64_t q = mod.power(3, 998244352);             // Returns 1, by Fermat
+   * mod.multiply_add(a, b, c, out);                        // out[i] = (a[i] * b[i] + c[i]) mod m
+   * @endcode
+   *
+   * @since 1.1
+   */
+  class ModContext
+  {
+  public:
+    /**
+     * @brief Precomputes the reduction constants for a modulus.
+     *
+     * @param[in] modulus The modulus m shared by all later operations.
+     *
+     * @throws std::invalid_argument If modulus is below 2.
+     *
+     * @pre modulus >= 2
+     */
+    explicit ModContext(std::uint64_t modulus);
+
+    /**
+     * @brief Returns the modulus this context was built for.
+     *
+     * @return The modulus m.
+     */
+    std::uint64_t modulus() const noexcept
+    {
+      return modulus_;
+    }
+
+    /**
+     * @brief Reduces an arbitrary value into \f$[0, m)\f$.
+     *
+     * @param[in] x The value to reduce.
+     *
+     * @return \f$x \bmod m\f$.
+     */
+    std::uint64_t reduce(std::uint64_t x) const noexcept
+    {
+      return remainder(0, x);
+    }
+
+    /**
+     * @brief Computes the modular sum of two reduced values.
+     *
+     * @param[in] a The first addend.
+     * @param[in] b The second addend.
+     *
+     * @return \f$(a + b) \bmod m\f$.
+     *
+     * @pre a < modulus() and b < modulus()
+     */
+    std::uint64_t add(std::uint64_t a, std::uint64_t b) const noexcept;
+
+    /**
+     * @brief Computes the modular product of two values.
+     *
+     * @param[in] a The first factor.
+     * @param[in] b The second factor.
+     *
+     * @return \f$(a \times b) \bmod m\f$.
+     */
+    std::uint64_t multiply(std::uint64_t a, std::uint64_t b) const noexcept
+    {
+      return reduce_product(uint128_t{a} * b);
+    }
+
+    /**
+     * @brief Raises a value to a power modulo m.
+     *
+     * @param[in] base The base.
+     * @param[in] exponent The exponent.
+     *
+     * @return \f$base^{exponent} \bmod m\f$, with \f$0^0 = 1\f$.
+     */
+    std::uint64_t power(std::uint64_t base, std::uint64_t exponent) const noexcept;
+
+    /**
+     * @brief Computes the modular sums of two spans element by element.
+     *
+     * @param[in] a The first addends.
+     * @param[in] b The second addends.
+     * @param[out] out The destination span receiving \f$(a_i + b_i) \bmod m\f$.
+     *
+     * @throws std::invalid_argument If the spans differ in size.
+     *
+     * @pre Every element of a and b is below modulus().
+     * @note out may alias a or b exactly, but must not partially overlap them.
+     */
+    void add(std::span<const std::uint64_t> a, std::span<const std::uint64_t> b, std::span<std::uint64_t> out) const;
+
+    /**
+     * @brief Computes the modular products of two spans element by element.
+     *
+     * @param[in] a The first factors.
+     * @param[in] b The second factors.
+     * @param[out] out The destination span receiving \f$(a_i \times b_i) \bmod m\f$.
+     *
+     * @throws std::invalid_argument If the spans differ in size.
+     *
+     * @pre Every element of a and b is below modulus().
+     * @note out may alias a or b exactly, but must not partially overlap them.
+     */
+    void multiply(std::span<const std::uint64_t> a, std::span<const std::uint64_t> b,
+                  std::span<std::uint64_t> out) const;
+
+    /**
+     * @brief Computes fused modular multiply-adds of three spans element by element.
+     *
+     * @param[in] a The first factors.
+     * @param[in] b The second factors.
+     * @param[in] c The addends.
+     * @param[out] out The destination span receiving \f$(a_i \times b_i + c_i) \bmod m\f$.
+     *
+     * @throws std::invalid_argument If the spans differ in size.
+     *
+     * @pre Every element of a, b and c is below modulus().
+     * @note out may alias an input exactly, but must not partially overlap it.
+     */
+    void multiply_add(std::span<const std::uint64_t> a, std::span<const std::uint64_t> b,
+                      std::span<const std::uint64_t> c, std::span<std::uint64_t> out) const;
+
+    /**
+     * @brief Raises every element of a span to the same power modulo m.
+     *
+     * @param[in] bases The bases.
+     * @param[in] exponent The exponent shared by all bases.
+     * @param[out] out The destination span receiving \f$base_i^{exponent} \bmod m\f$.
+     *
+     * @throws std::invalid_argument If the spans differ in size.
+     *
+     * @pre Every element of bases is below modulus().
+     * @note out may alias bases exactly, but must not partially overlap it.
+     */
+    void power(std::span<const std::uint64_t> bases, std::uint64_t exponent, std::span<std::uint64_t> out) const;
+
+  private:
+    // (high * 2^64 + low) mod m for high < m: the 2-by-1 division of Moller
+    // and Granlund, whose quotient estimate from the reciprocal of the
+    // normalized modulus needs one widening multiply and two corrections
+    std::uint64_t remainder(std::uint64_t high, std::uint64_t low) const noexcept
+    {
+      const std::uint64_t d = normalized_;
+      // Two half shifts keep a zero shift defined
+      const std::uint64_t u1 = (high << shift_) | ((low >> 1) >> (63 - shift_));
+      const std::uint64_t u0 = low << shift_;
+
+      const uint128_t q = uint128_t{reciprocal_} * u1 + ((uint128_t{u1 + 1} << 64) | u0);
+      std::uint64_t r = u0 - static_cast<std::uint64_t>(q >> 64) * d;
+      r += d & (0 - static_cast<std::uint64_t>(r > static_cast<std::uint64_t>(q)));
+      if (r >= d) [[unlikely]]
+      {
+        r -= d;
+      }
+
+      return r >> shift_;
+    }
+
+    std::uint64_t reduce_product(uint128_t x) const noexcept
+    {
+      auto high = static_cast<std::uint64_t>(x >> 64);
+      if (high >= modulus_) [[unlikely]]
+      {
+        // Only a product of two unreduced operands gets here
+        high = remainder(0, high);
+      }
+
+      return remainder(high, static_cast<std::uint64_t>(x));
+    }
+
+    std::uint64_t modulus_;
+    unsigned shift_ = 0;           // leading zeros of m
+    std::uint64_t normalized_ = 0; // m << shift_, with the top bit set
+    std::uint64_t reciprocal_ = 0; // floor((2^128 - 1) / normalized_) - 2^64
+    std::uint64_t inverse_ = 0;    // m^-1 mod 2^64, for odd m only
+    std::uint64_t r_ = 0;          // 2^64 mod m
+    std::uint64_t r2_ = 0;         // 2^128 mod m
+    std::uint64_t r32_ = 0;        // 2^32 mod m
+  };
+
+} // namespace cpp_concept
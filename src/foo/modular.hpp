@@ -0,0 +1,312 @@
+#pragma once
+
+/**
+ * @file foo/modular.hpp
+ * @brief Internal helpers for 64-bit modular arithmetic and primality testing.
+ *
+ * This header is private to the foo library. It provides the integer square
+ * root, the 128-bit widening multiply-modulo, Montgomery arithmetic for odd
+ * 64-bit moduli and the deterministic Miller-Rabin test shared by the
+ * number-theoretic Foo algorithms.
+ *
+ * @author Sentenz
+ * @copyright Copyright (c) 2026 Sentenz
+ * @license SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "foo/int128.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+
+namespace cpp_concept::modular
+{
+
+  /**
+   * @brief Computes \f$\lfloor \sqrt{n} \rfloor\f$ exactly.
+   *
+   * Corrects the double-precision estimate, which may be off by one for
+   * large n.
+   */
+  inline std::uint64_t isqrt(std::uint64_t n) noexcept
+  {
+    auto root = static_cast<std::uint64_t>(std::sqrt(static_cast<double>(n)));
+    root = std::min<std::uint64_t>(root, 0xFFFFFFFFULL);
+    while (root * root > n)
+    {
+      --root;
+    }
+    while (root < 0xFFFFFFFFULL && (root + 1) * (root + 1) <= n)
+    {
+      ++root;
+    }
+
+    return root;
+  }
+
+  /**
+   * @brief Computes \f$a \cdot b \bmod m\f$ without overflow.
+   *
+   * @pre m > 0
+   */
+  inline std::uint64_t mulmod(std::uint64_t a, std::uint64_t b, std::uint64_t m) noexcept
+  {
+    return static_cast<std::uint64_t>(static_cast<uint128_t>(a) * b % m);
+  }
+
+  /**
+   * @brief Computes \f$base^{exponent} \bmod m\f$ by binary exponentiation.
+   *
+   * @pre m > 0
+   */
+  inline std::uint64_t powmod(std::uint64_t base, std::uint64_t exponent, std::uint64_t m) noexcept
+  {
+    std::uint64_t result = 1 % m;
+    base %= m;
+    while (exponent != 0)
+    {
+      if (exponent & 1)
+      {
+        result = mulmod(result, base, m);
+      }
+      base = mulmod(base, base, m);
+      exponent >>= 1;
+    }
+
+    return result;
+  }
+
+  /**
+   * @brief Computes \f$p^{-1} \bmod 2^k\f$ for odd p, where k is the width of T.
+   *
+   * Newton's iteration doubles the correct low bits from 3, since
+   * \f$p \cdot p \equiv 1 \pmod 8\f$ for every odd p.
+   *
+   * @pre p is odd
+   */
+  template <std::unsigned_integral T>
+  constexpr T inverse_mod_2k(T p) noexcept
+  {
+    T inverse = p;
+    for (int bits = 3; bits < std::numeric_limits<T>::digits; bits *= 2)
+    {
+      inverse = static_cast<T>(inverse * static_cast<T>(2 - p * inverse));
+    }
+
+    return inverse;
+  }
+
+  /**
+   * @brief Computes \f$(a + b) \bmod n\f$ for a, b < n.
+   *
+   * Masking instead of selecting keeps the compiler from branching on the
+   * wrap, which is unpredictable for random operands; subtract_mod() alike.
+   */
+  inline std::uint64_t add_mod(std::uint64_t a, std::uint64_t b, std::uint64_t n) noexcept
+  {
+    const std::uint64_t sum = a + b;
+    const auto wrap = static_cast<std::uint64_t>((sum < a) | (sum >= n));
+    return sum - (n & (0 - wrap));
+  }
+
+  /**
+   * @brief Computes \f$(a - b) \bmod n\f$ for a, b < n.
+   */
+  inline std::uint64_t subtract_mod(std::uint64_t a, std::uint64_t b, std::uint64_t n) noexcept
+  {
+    return a - b + (n & (0 - static_cast<std::uint64_t>(a < b)));
+  }
+
+  /**
+   * @brief Computes \f$t \cdot 2^{-64} \bmod n\f$ for odd n and \f$t < n \cdot 2^{64}\f$.
+   *
+   * @param[in] inverse \f$n^{-1} \bmod 2^{64}\f$, as returned by Montgomery::inverse().
+   */
+  inline std::uint64_t montgomery_reduce(uint128_t t, std::uint64_t n, std::uint64_t inverse) noexcept
+  {
+    // The low halves of t and m * n agree by construction of m, so the
+    // reduction is a difference of high halves
+    const std::uint64_t m = static_cast<std::uint64_t>(t) * inverse;
+    const auto hi = static_cast<std::uint64_t>(t >> 64);
+    const auto mn = static_cast<std::uint64_t>(static_cast<uint128_t>(m) * n >> 64);
+    return hi >= mn ? hi - mn : hi - mn + n;
+  }
+
+  /**
+   * @brief Montgomery arithmetic modulo an odd 64-bit integer.
+   *
+   * Values in Montgomery form are \f$x \cdot 2^{64} \bmod n\f$, so a product
+   * is reduced with two multiplications and no division.
+   */
+  class Montgomery
+  {
+  public:
+    /**
+     * @pre n is odd
+     */
+    explicit Montgomery(std::uint64_t n) noexcept
+        : n_(n), inverse_(inverse_mod_2k(n))
+    {
+      one_ = (0 - n) % n;
+      r2_ = static_cast<std::uint64_t>(static_cast<uint128_t>(one_) * one_ % n);
+    }
+
+    std::uint64_t modulus() const noexcept
+    {
+      return n_;
+    }
+
+    /// Returns \f$n^{-1} \bmod 2^{64}\f$.
+    std::uint64_t inverse() const noexcept
+    {
+      return inverse_;
+    }
+
+    /// Computes \f$t \cdot 2^{-64} \bmod n\f$ for \f$t < n \cdot 2^{64}\f$.
+    std::uint64_t reduce(uint128_t t) const noexcept
+    {
+      return montgomery_reduce(t, n_, inverse_);
+    }
+
+    /// Montgomery product of two values in Montgomery form.
+    std::uint64_t multiply(std::uint64_t a, std::uint64_t b) const noexcept
+    {
+      return reduce(static_cast<uint128_t>(a) * b);
+    }
+
+    /// Sum modulo n of two values below n, in or out of Montgomery form.
+    std::uint64_t add(std::uint64_t a, std::uint64_t b) const noexcept
+    {
+      return add_mod(a, b, n_);
+    }
+
+    /// Difference modulo n of two values below n, in or out of Montgomery form.
+    std::uint64_t subtract(std::uint64_t a, std::uint64_t b) const noexcept
+    {
+      return subtract_mod(a, b, n_);
+    }
+
+    /// Converts x into Montgomery form.
+    std::uint64_t to(std::uint64_t x) const noexcept
+    {
+      return multiply(x % n_, r2_);
+    }
+
+    /// Converts x out of Montgomery form.
+    std::uint64_t from(std::uint64_t x) const noexcept
+    {
+      return reduce(x);
+    }
+
+    /// Raises x in Montgomery form to the power exponent, in Montgomery form.
+    std::uint64_t power(std::uint64_t x, std::uint64_t exponent) const noexcept
+    {
+      std::uint64_t result = one_;
+      for (; exponent != 0; exponent >>= 1)
+      {
+        if (exponent & 1)
+        {
+          result = multiply(result, x);
+        }
+        x = multiply(x, x);
+      }
+
+      return result;
+    }
+
+  private:
+    std::uint64_t n_;
+    std::uint64_t inverse_;
+    std::uint64_t one_; // 2^64 mod n, which is 1 in Montgomery form
+    std::uint64_t r2_;
+  };
+
+  /**
+   * @brief Runs one Miller-Rabin round.
+   *
+   * @param[in] n The odd candidate, n > 2.
+   * @param[in] base The witness to try.
+   * @param[in] d The odd part of n - 1.
+   * @param[in] s The exponent of two in n - 1, so that \f$n - 1 = d \cdot 2^s\f$.
+   *
+   * @return False if base proves n composite, true otherwise.
+   */
+  inline bool strong_probable_prime(std::uint64_t n, std::uint64_t base, std::uint64_t d, int s) noexcept
+  {
+    base %= n;
+    if (base == 0)
+    {
+      return true;
+    }
+
+    std::uint64_t x = powmod(base, d, n);
+    if (x == 1 || x == n - 1)
+    {
+      return true;
+    }
+
+    for (int r = 1; r < s; ++r)
+    {
+      x = mulmod(x, x, n);
+      if (x == n - 1)
+      {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  /**
+   * @brief Deterministic Miller-Rabin test for odd 64-bit integers.
+   *
+   * Uses the seven bases found by Jim Sinclair, which admit no strong
+   * pseudoprime below \f$2^{64}\f$.
+   *
+   * @param[in] n The odd candidate, n > 2.
+   *
+   * @return True if and only if n is prime.
+   */
+  inline bool miller_rabin(std::uint64_t n) noexcept
+  {
+    static constexpr std::array<std::uint64_t, 7> bases = {2, 325, 9375, 28178, 450775, 9780504, 1795265022};
+
+    // Every round runs in Montgomery form, where 1 and n - 1 become one and minus_one
+    const Montgomery mont(n);
+    const std::uint64_t one = mont.to(1);
+    const std::uint64_t minus_one = n - one;
+    const int s = std::countr_zero(n - 1);
+    const std::uint64_t d = (n - 1) >> s;
+    for (const auto base : bases)
+    {
+      const std::uint64_t a = mont.to(base);
+      if (a == 0)
+      {
+        continue;
+      }
+
+      std::uint64_t x = mont.power(a, d);
+      int r = 1;
+      for (; x != one && x != minus_one && r < s; ++r)
+      {
+        x = mont.multiply(x, x);
+      }
+      if (x != one && x != minus_one)
+      {
+        return false;
+      }
+      if (x == one && r > 1)
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+} // namespace cpp_concept::modular
@@ -0,0 +1,147 @@
+#include "foo/modular_combinatorics.hpp"
+#include "foo/modular.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace cpp_concept
+{
+
+  ModularCombinatorics::ModularCombinatorics(std::uint64_t p, std::size_t limit)
+      : p_(p)
+  {
+    if (p != 2 && (p < 2 || p % 2 == 0 || !modular::miller_rabin(p)))
+    {
+      throw std::invalid_argument("Modulus must be prime");
+    }
+
+    const std::size_t size = static_cast<std::size_t>(std::min<std::uint64_t>(limit, p - 1)) + 1;
+    factorials_.resize(size, 1);
+    inverse_factorials_.resize(size, 1);
+    if (p == 2)
+    {
+      // 0! and 1! are both 1, and binomials follow the bits of n and r
+      return;
+    }
+
+    // Both tables are built in Montgomery form, with i stepped by adding one,
+    // so no entry costs a division
+    const modular::Montgomery mont(p);
+    inverse_ = mont.inverse();
+    cube_ = mont.to(mont.to(mont.to(1)));
+
+    const std::uint64_t one = mont.to(1);
+    std::uint64_t i = 0;         // i in Montgomery form
+    std::uint64_t running = one; // i! in Montgomery form
+    for (std::size_t n = 1; n < size; ++n)
+    {
+      i = mont.add(i, one);
+      running = mont.multiply(running, i);
+      factorials_[n] = mont.from(running);
+    }
+
+    // Fermat's little theorem inverts the last factorial; each earlier
+    // inverse is the next one times n
+    running = mont.power(running, p - 2);
+    for (std::size_t n = size - 1; n > 0; --n)
+    {
+      inverse_factorials_[n] = mont.from(running);
+      running = mont.multiply(running, i);
+      i = mont.subtract(i, one);
+    }
+  }
+
+  std::uint64_t ModularCombinatorics::factorial(std::uint64_t n) const
+  {
+    if (n < factorials_.size())
+    {
+      return factorials_[n];
+    }
+    if (n >= p_)
+    {
+      return 0;
+    }
+
+    throw std::out_of_range("Value is outside the factorial table");
+  }
+
+  std::uint64_t ModularCombinatorics::inverse_factorial(std::uint64_t n) const
+  {
+    if (n >= inverse_factorials_.size())
+    {
+      throw std::out_of_range("Value is outside the factorial table");
+    }
+
+    return inverse_factorials_[n];
+  }
+
+  std::uint64_t ModularCombinatorics::inverse(std::uint64_t n) const
+  {
+    if (n == 0 || n >= factorials_.size())
+    {
+      throw std::out_of_range("Value has no inverse in the factorial table");
+    }
+
+    return modular::mulmod(factorials_[n - 1], inverse_factorials_[n], p_);
+  }
+
+  std::uint64_t ModularCombinatorics::table_binomial(std::uint64_t n, std::uint64_t r) const noexcept
+  {
+    // Each reduction divides by 2^64, and multiplying by cube_ cancels all three
+    const auto multiply = [this](std::uint64_t a, std::uint64_t b)
+    { return modular::montgomery_reduce(static_cast<uint128_t>(a) * b, p_, inverse_); };
+
+    return multiply(multiply(multiply(factorials_[n], inverse_factorials_[r]), inverse_factorials_[n - r]), cube_);
+  }
+
+  std::uint64_t ModularCombinatorics::binomial(std::uint64_t n, std::uint64_t r) const
+  {
+    if (r > n)
+    {
+      return 0;
+    }
+    if (p_ == 2)
+    {
+      // Lucas's theorem over base 2: every set bit of r must be set in n
+      return (r & ~n) == 0 ? 1 : 0;
+    }
+    if (n < factorials_.size())
+    {
+      return table_binomial(n, r);
+    }
+
+    // Lucas's theorem; once r runs out of digits the remaining factors are 1
+    std::uint64_t result = 1;
+    for (; r != 0; n /= p_, r /= p_)
+    {
+      const std::uint64_t n_digit = n % p_;
+      const std::uint64_t r_digit = r % p_;
+      if (r_digit > n_digit)
+      {
+        return 0;
+      }
+      if (n_digit >= factorials_.size())
+      {
+        throw std::out_of_range("Digit of n is outside the factorial table");
+      }
+      result = modular::mulmod(result, table_binomial(n_digit, r_digit), p_);
+    }
+
+    return result;
+  }
+
+  void ModularCombinatorics::binomial(std::span<const std::uint64_t> n, std::span<const std::uint64_t> r,
+                                      std::span<std::uint64_t> out) const
+  {
+    if (n.size() != r.size() || n.size() != out.size())
+    {
+      throw std::invalid_argument("Span sizes must match");
+    }
+
+    for (std::size_t i = 0; i < n.size(); ++i)
+    {
+      out[i] = binomial(n[i], r[i]);
+    }
+  }
+
+} // namespace cpp_concept
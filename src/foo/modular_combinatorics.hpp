@@ -0,0 +1,152 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/**
+ * @file foo/modular_combinatorics.hpp
+ * @brief Header file for the ModularCombinatorics class answering binomials modulo a prime.
+ *
+ * This file defines the ModularCombinatorics class within the cpp_concept
+ * namespace. A ModularCombinatorics precomputes factorials and their
+ * inverses modulo a prime once, so binomial coefficients that would
+ * overflow any built-in type are answered in constant time.
+ *
+ * @author Sentenz
+ * @copyright Copyright (c) 2026 Sentenz
+ * @license SPDX-License-Identifier: Apache-2.0
+ */
+
+namespace cpp_concept
+{
+
+  /**
+   * @brief Factorial, inverse factorial and binomial tables modulo a prime p.
+   *
+   * Holds \f$n! \bmod p\f$ and \f$(n!)^{-1} \bmod p\f$ for every n up to
+   * limit(), 16 bytes per entry. The inverses cost one modular
+   * exponentiation for the last entry and one multiplication for each
+   * earlier one, since \f$((n-1)!)^{-1} = n \cdot (n!)^{-1}\f$. A binomial
+   * within the table is then three multiplications in Montgomery form with
+   * no division.
+   *
+   * Binomials with n past the table are answered by Lucas's theorem,
+   * \f$\binom{n}{r} \equiv \prod_i \binom{n_i}{r_i} \pmod p\f$ over the
+   * base-p digits of n and r, which needs the table for every digit. So
+   * any n works when the table reaches p - 1.
+   *
+   * @note Thread safety: The tables are immutable after construction, so
+   *       queries are safe from any number of threads.
+   *
+   * @see Foo::factorial()
+   *
+   * @code
+   * ModularCombinatorics mod(1000000007, 1000000);
+   * mod.binomial(1000000, 500000);  // Returns 996692777
+   * ModularCombinatorics small(13, 12);
+   * small.binomial(1000000000000ULL, 3);  // Lucas's theorem over base 13
+   * @endcode
+   *
+   * @since 1.1
+   */
+  class ModularCombinatorics
+  {
+  public:
+    /**
+     * @brief Builds the tables for 0, 1, ..., min(limit, p - 1).
+     *
+     * @param[in] p The prime modulus.
+     * @param[in] limit The largest n to tabulate; entries from p on would be zero and are left out.
+     *
+     * @throws std::invalid_argument If p is not prime.
+     */
+    ModularCombinatorics(std::uint64_t p, std::size_t limit);
+
+    /**
+     * @brief Returns the prime modulus.
+     */
+    std::uint64_t modulus() const noexcept
+    {
+      return p_;
+    }
+
+    /**
+     * @brief Returns the largest n held by the tables.
+     */
+    std::size_t limit() const noexcept
+    {
+      return factorials_.size() - 1;
+    }
+
+    /**
+     * @brief Returns \f$n! \bmod p\f$.
+     *
+     * @param[in] n The argument, at most limit() or at least p.
+     *
+     * @return \f$n! \bmod p\f$, which is 0 for n >= p.
+     *
+     * @throws std::out_of_range If limit() < n < p.
+     */
+    std::uint64_t factorial(std::uint64_t n) const;
+
+    /**
+     * @brief Returns \f$(n!)^{-1} \bmod p\f$.
+     *
+     * @param[in] n The argument, at most limit().
+     *
+     * @throws std::out_of_range If n is greater than limit().
+     */
+    std::uint64_t inverse_factorial(std::uint64_t n) const;
+
+    /**
+     * @brief Returns \f$n^{-1} \bmod p\f$ from the tables, as \f$(n-1)! \cdot (n!)^{-1}\f$.
+     *
+     * @param[in] n The argument, with 1 <= n <= limit().
+     *
+     * @throws std::out_of_range If n is zero or greater than limit().
+     */
+    std::uint64_t inverse(std::uint64_t n) const;
+
+    /**
+     * @brief Returns \f$\binom{n}{r} \bmod p\f$.
+     *
+     * Reads the tables directly for n <= limit() and applies Lucas's theorem
+     * otherwise.
+     *
+     * @param[in] n The size of the set.
+     * @param[in] r The size of the subsets.
+     *
+     * @return \f$\binom{n}{r} \bmod p\f$, which is 0 for r > n.
+     *
+     * @throws std::out_of_range If Lucas's theorem needs a base-p digit of n
+     *         greater than limit().
+     */
+    std::uint64_t binomial(std::uint64_t n, std::uint64_t r) const;
+
+    /**
+     * @brief Computes binomials modulo p for spans of arguments.
+     *
+     * @param[in] n The sizes of the sets.
+     * @param[in] r The sizes of the subsets.
+     * @param[out] out Receives \f$\binom{n_i}{r_i} \bmod p\f$.
+     *
+     * @throws std::invalid_argument If the span sizes differ.
+     * @throws std::out_of_range If any pair is out of range as for binomial().
+     */
+    void binomial(std::span<const std::uint64_t> n, std::span<const std::uint64_t> r,
+                  std::span<std::uint64_t> out) const;
+
+  private:
+    // Binomial for n <= limit()
+    std::uint64_t table_binomial(std::uint64_t n, std::uint64_t r) const noexcept;
+
+    std::uint64_t p_;
+    std::uint64_t inverse_ = 0; // p^-1 mod 2^64, for Montgomery reduction
+    std::uint64_t cube_ = 0;    // 2^192 mod p, which undoes the three reductions of a binomial
+    std::vector<std::uint64_t> factorials_;
+    std::vector<std::uint64_t> inverse_factorials_;
+  };
+
+} // namespace cpp_concept
@@ -0,0 +1,202 @@
+#pragma once
+
+/**
+ * @file foo/parallel.hpp
+ * @brief Internal helpers for splitting Foo workloads across threads.
+ *
+ * This header is private to the foo library. It divides an index range into
+ * contiguous chunks and runs one chunk per thread, so that the batch
+ * algorithms share one threading policy.
+ *
+ * @author Sentenz
+ * @copyright Copyright (c) 2026 Sentenz
+ * @license SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <barrier>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace cpp_concept::parallel
+{
+
+  /**
+   * @brief Resolves a requested thread count.
+   *
+   * @param[in] threads The requested number of threads, 0 for one per hardware thread.
+   *
+   * @return The number of threads to use, at least 1.
+   */
+  inline unsigned resolve(unsigned threads) noexcept
+  {
+    if (threads == 0)
+    {
+      threads = std::thread::hardware_concurrency();
+    }
+
+    return std::max(threads, 1U);
+  }
+
+  /**
+   * @brief Computes how many chunks a range should be split into.
+   *
+   * @param[in] n The number of elements in the range.
+   * @param[in] threads The requested number of threads, 0 for one per hardware thread.
+   * @param[in] grain The minimum number of elements worth a thread of its own.
+   *
+   * @return The number of chunks, between 1 and resolve(threads).
+   */
+  inline std::size_t chunk_count(std::size_t n, unsigned threads, std::size_t grain) noexcept
+  {
+    const std::size_t useful = std::max<std::size_t>(n / std::max<std::size_t>(grain, 1), 1);
+    return std::min<std::size_t>(resolve(threads), useful);
+  }
+
+  /**
+   * @brief Runs a function over contiguous chunks of [0, n) in parallel.
+   *
+   * Chunk 0 runs on the calling thread and every other chunk on a thread of
+   * its own. All threads are joined before returning.
+   *
+   * @param[in] n The number of elements in the range.
+   * @param[in] chunks The number of chunks, as returned by chunk_count().
+   * @param[in] fn Callable invoked as fn(chunk, first, last).
+   *
+   * @throws Any exception thrown by fn, rethrown once every thread has finished.
+   */
+  template <typename Fn>
+  void for_each_chunk(std::size_t n, std::size_t chunks, Fn &&fn)
+  {
+    chunks = std::max<std::size_t>(chunks, 1);
+
+    std::vector<std::exception_ptr> errors(chunks);
+    auto run = [&](std::size_t chunk)
+    {
+      try
+      {
+        fn(chunk, n * chunk / chunks, n * (chunk + 1) / chunks);
+      }
+      catch (...)
+      {
+        errors[chunk] = std::current_exception();
+      }
+    };
+
+    {
+      std::vector<std::jthread> workers;
+      workers.reserve(chunks - 1);
+      for (std::size_t chunk = 1; chunk < chunks; ++chunk)
+      {
+        workers.emplace_back(run, chunk);
+      }
+
+      run(0);
+    }
+
+    for (const auto &error : errors)
+    {
+      if (error)
+      {
+        std::rethrow_exception(error);
+      }
+    }
+  }
+
+  /**
+   * @brief Runs a function over [0, n) in rounds on one set of threads.
+   *
+   * Splits [0, n) into rounds of round elements and every round into the
+   * same number of contiguous chunks. The chunks - 1 threads are spawned once
+   * for the whole range rather than once per round. Each round fills one of
+   * two result slots; as soon as every chunk of a round is done, deliver runs
+   * on the calling thread while the other threads go on with the next round
+   * into the other slot, so at most two rounds of results are held.
+   *
+   * @param[in] n The number of elements in the range.
+   * @param[in] round The number of elements per round, at least 1.
+   * @param[in] chunks The number of chunks per round, as returned by chunk_count().
+   * @param[in] fn Callable invoked as fn(slot, chunk, first, last), possibly with first == last.
+   * @param[in] deliver Callable invoked as deliver(slot) on the calling thread, once per round in order.
+   *
+   * @throws Any exception thrown by fn or deliver, rethrown once every thread
+   *         has finished. No round is delivered after the first exception.
+   */
+  template <typename Fn, typename Deliver>
+  void for_each_round(std::size_t n, std::size_t round, std::size_t chunks, Fn &&fn, Deliver &&deliver)
+  {
+    chunks = std::max<std::size_t>(chunks, 1);
+    const std::size_t rounds = (n + round - 1) / round;
+
+    std::vector<std::exception_ptr> errors(chunks);
+    std::atomic<bool> stop = false;
+    // Snapshot of stop taken once every thread has arrived, so all threads
+    // decide alike even when deliver throws while the others pass the barrier
+    bool stopped = false;
+    std::barrier sync(static_cast<std::ptrdiff_t>(chunks), [&]() noexcept { stopped = stop; });
+    auto run = [&](std::size_t chunk)
+    {
+      for (std::size_t r = 0; r < rounds; ++r)
+      {
+        const std::size_t start = r * round;
+        const std::size_t count = std::min(round, n - start);
+        try
+        {
+          if (!stop)
+          {
+            fn(r & 1, chunk, start + count * chunk / chunks, start + count * (chunk + 1) / chunks);
+          }
+        }
+        catch (...)
+        {
+          errors[chunk] = std::current_exception();
+          stop = true;
+        }
+
+        // stopped only changes once every thread has arrived again, so all
+        // of them leave the loop in the same round
+        sync.arrive_and_wait();
+        if (stopped)
+        {
+          return;
+        }
+
+        if (chunk == 0)
+        {
+          try
+          {
+            deliver(r & 1);
+          }
+          catch (...)
+          {
+            errors[chunk] = std::current_exception();
+            stop = true;
+          }
+        }
+      }
+    };
+
+    {
+      std::vector<std::jthread> workers;
+      workers.reserve(chunks - 1);
+      for (std::size_t chunk = 1; chunk < chunks; ++chunk)
+      {
+        workers.emplace_back(run, chunk);
+      }
+
+      run(0);
+    }
+
+    for (const auto &error : errors)
+    {
+      if (error)
+      {
+        std::rethrow_exception(error);
+      }
+    }
+  }
+
+} // namespace cpp_concept::parallel
@@ -0,0 +1,207 @@
+#include "foo/prime_table.hpp"
+#include "foo/parallel.hpp"
+#include "foo/sieve.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace cpp_concept
+{
+
+  namespace
+  {
+
+    // Leading bytes of every table file
+    constexpr std::array<char, 8> magic = {'P', 'R', 'I', 'M', 'E', '3', '0', '\0'};
+
+    struct Header
+    {
+      std::array<char, 8> magic;
+      std::uint64_t limit;
+    };
+
+    // Segments sieved per task when writing a table
+    constexpr std::size_t segments_per_task = 8;
+
+    std::size_t table_size(std::uint64_t limit) noexcept
+    {
+      return sizeof(Header) + static_cast<std::size_t>((limit + 29) / 30);
+    }
+
+    // Closes a file descriptor on scope exit
+    struct Descriptor
+    {
+      int fd;
+
+      ~Descriptor()
+      {
+        if (fd >= 0)
+        {
+          ::close(fd);
+        }
+      }
+    };
+
+    [[noreturn]] void throw_errno(const std::string &what)
+    {
+      throw std::system_error(errno, std::generic_category(), what);
+    }
+
+  } // namespace
+
+  PrimeTable::PrimeTable(const std::string &path)
+  {
+    const Descriptor file{::open(path.c_str(), O_RDONLY | O_CLOEXEC)};
+    if (file.fd < 0)
+    {
+      throw_errno("Cannot open prime table " + path);
+    }
+
+    struct stat status;
+    if (::fstat(file.fd, &status) != 0)
+    {
+      throw_errno("Cannot stat prime table " + path);
+    }
+    if (status.st_size < static_cast<off_t>(sizeof(Header)))
+    {
+      throw std::runtime_error("Prime table is truncated: " + path);
+    }
+
+    const auto size = static_cast<std::size_t>(status.st_size);
+    void *map = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, file.fd, 0);
+    if (map == MAP_FAILED)
+    {
+      throw_errno("Cannot map prime table " + path);
+    }
+
+    Header header;
+    std::copy_n(static_cast<const char *>(map), sizeof(Header), reinterpret_cast<char *>(&header));
+    if (header.magic != magic || header.limit > max_limit || table_size(header.limit) != size)
+    {
+      ::munmap(map, size);
+      throw std::runtime_error("Not a prime table: " + path);
+    }
+
+    map_ = map;
+    size_ = size;
+    bytes_ = static_cast<const std::uint8_t *>(map) + sizeof(Header);
+    limit_ = header.limit;
+  }
+
+  PrimeTable::PrimeTable(PrimeTable &&other) noexcept
+      : map_(std::exchange(other.map_, nullptr)), size_(std::exchange(other.size_, 0)),
+        bytes_(std::exchange(other.bytes_, nullptr)), limit_(std::exchange(other.limit_, 0))
+  {
+  }
+
+  PrimeTable &PrimeTable::operator=(PrimeTable &&other) noexcept
+  {
+    if (this != &other)
+    {
+      if (map_ != nullptr)
+      {
+        ::munmap(map_, size_);
+      }
+      map_ = std::exchange(other.map_, nullptr);
+      size_ = std::exchange(other.size_, 0);
+      bytes_ = std::exchange(other.bytes_, nullptr);
+      limit_ = std::exchange(other.limit_, 0);
+    }
+
+    return *this;
+  }
+
+  PrimeTable::~PrimeTable()
+  {
+    if (map_ != nullptr)
+    {
+      ::munmap(map_, size_);
+    }
+  }
+
+  void PrimeTable::write(const std::string &path, std::uint64_t limit, unsigned threads)
+  {
+    if (limit > max_limit)
+    {
+      throw std::invalid_argument("Limit exceeds the 32-bit domain");
+    }
+
+    // mkostemp picks a fresh name, so concurrent writers of one path never
+    // share a temporary, and the table only appears under path once complete
+    std::string temporary = path + ".XXXXXX";
+    const std::size_t size = table_size(limit);
+    const Descriptor file{::mkostemp(temporary.data(), O_CLOEXEC)};
+    if (file.fd < 0)
+    {
+      throw_errno("Cannot create prime table " + temporary);
+    }
+
+    void *map = nullptr;
+    if (::fchmod(file.fd, 0644) != 0 || ::ftruncate(file.fd, static_cast<off_t>(size)) != 0 ||
+        (map = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file.fd, 0)) == MAP_FAILED)
+    {
+      const int error = errno;
+      ::unlink(temporary.c_str());
+      throw std::system_error(error, std::generic_category(), "Cannot size prime table " + temporary);
+    }
+
+    try
+    {
+      const Header header{magic, limit};
+      std::copy_n(reinterpret_cast<const char *>(&header), sizeof(Header), static_cast<char *>(map));
+
+      // Segments start at multiples of 30, so each one fills whole table bytes
+      // and chunks write disjoint parts of the mapping
+      std::uint8_t *bytes = static_cast<std::uint8_t *>(map) + sizeof(Header);
+      const std::vector<std::uint32_t> primes = sieve::base_primes(limit);
+      const std::uint64_t segments = (limit + sieve::segment_span - 1) / sieve::segment_span;
+      const std::size_t chunks = parallel::chunk_count(segments, threads, segments_per_task);
+      parallel::for_each_chunk(segments, chunks,
+                               [&](std::size_t, std::size_t a, std::size_t b)
+                               {
+                                 const std::uint64_t first = a * sieve::segment_span;
+                                 const std::uint64_t last = std::min<std::uint64_t>(b * sieve::segment_span, limit);
+                                 sieve::Segments sieve(primes, first, last);
+                                 std::uint8_t *out = bytes + first / 30;
+                                 while (sieve.next())
+                                 {
+                                   const auto segment = sieve.bytes();
+                                   out = std::copy(segment.begin(), segment.end(), out);
+                                 }
+                               });
+    }
+    catch (...)
+    {
+      ::munmap(map, size);
+      ::unlink(temporary.c_str());
+      throw;
+    }
+
+    ::munmap(map, size);
+
+    // Flushed before the rename, so a crash never leaves a partial table under path
+    if (::fsync(file.fd) != 0)
+    {
+      const int error = errno;
+      ::unlink(temporary.c_str());
+      throw std::system_error(error, std::generic_category(), "Cannot sync prime table " + temporary);
+    }
+    if (::rename(temporary.c_str(), path.c_str()) != 0)
+    {
+      const int error = errno;
+      ::unlink(temporary.c_str());
+      throw std::system_error(error, std::generic_category(), "Cannot rename prime table to " + path);
+    }
+  }
+
+} // namespace cpp_concept
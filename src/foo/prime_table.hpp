@@ -0,0 +1,146 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+/**
+ * @file foo/prime_table.hpp
+ * @brief Header file for the PrimeTable class answering primality from a mapped file.
+ *
+ * This file defines the PrimeTable class within the cpp_concept namespace. A
+ * PrimeTable maps a precomputed primality bitmap for the 32-bit domain
+ * read-only, so a lookup is a single bit test and every process on a host
+ * shares one page-cache copy of the table instead of recomputing it.
+ *
+ * @author Sentenz
+ * @copyright Copyright (c) 2026 Sentenz
+ * @license SPDX-License-Identifier: Apache-2.0
+ */
+
+namespace cpp_concept
+{
+
+  /**
+   * @brief Read-only, memory-mapped primality bitmap for [0, limit).
+   *
+   * The file holds a 16-byte header followed by one byte per 30 integers,
+   * with a bit for each of the eight residues coprime to 30, so the full
+   * 32-bit domain takes about 137 MiB. Multiples of 2, 3 and 5 are answered
+   * without touching the map. Opening a table costs one mmap() call; pages
+   * are faulted in on first use. The file is written in native byte order
+   * by write() or the prime-table tool.
+   *
+   * @note Thread safety: Lookups are safe from any number of threads, since
+   *       the mapping is never modified.
+   *
+   * @see Foo::is_prime()
+   *
+   * @code
+   * PrimeTable::write("primes.bin");
+   * PrimeTable table("primes.bin");
+   * table.is_prime(4294967291U);  // Returns true, the largest 32-bit prime
+   * @endcode
+   *
+   * @since 1.1
+   */
+  class PrimeTable
+  {
+  public:
+    /// Largest limit a table may cover, the whole 32-bit domain.
+    static constexpr std::uint64_t max_limit = std::uint64_t{1} << 32;
+
+    /**
+     * @brief Maps an existing table read-only.
+     *
+     * @param[in] path The file written by write().
+     *
+     * @throws std::system_error If the file cannot be opened or mapped.
+     * @throws std::runtime_error If the file is not a prime table or is truncated.
+     */
+    explicit PrimeTable(const std::string &path);
+
+    PrimeTable(const PrimeTable &) = delete;
+    PrimeTable &operator=(const PrimeTable &) = delete;
+
+    /**
+     * @brief Takes over the mapping of other, leaving it empty.
+     */
+    PrimeTable(PrimeTable &&other) noexcept;
+
+    /**
+     * @brief Unmaps the current table and takes over the mapping of other.
+     */
+    PrimeTable &operator=(PrimeTable &&other) noexcept;
+
+    /**
+     * @brief Unmaps the table.
+     */
+    ~PrimeTable();
+
+    /**
+     * @brief Returns the exclusive upper bound of the table.
+     *
+     * @return The limit passed to write() when the file was created.
+     */
+    std::uint64_t limit() const noexcept
+    {
+      return limit_;
+    }
+
+    /**
+     * @brief Checks whether n is prime with a single bit lookup.
+     *
+     * @param[in] n The value to check.
+     *
+     * @return True if n is prime.
+     *
+     * @throws std::out_of_range If n is at least limit().
+     */
+    bool is_prime(std::uint32_t n) const
+    {
+      if (n >= limit_)
+      {
+        throw std::out_of_range("Value is outside the prime table");
+      }
+
+      const std::uint8_t bit = wheel_bits_[n % 30];
+      if (bit == 0)
+      {
+        return n == 2 || n == 3 || n == 5;
+      }
+
+      return (bytes_[n / 30] & bit) != 0;
+    }
+
+    /**
+     * @brief Sieves [0, limit) and writes the table to a file.
+     *
+     * The table is built in a uniquely named temporary file next to path,
+     * flushed to disk and renamed over path once complete, so processes
+     * opening path never see a partial table, even after a crash.
+     *
+     * @param[in] path The file to create or replace.
+     * @param[in] limit The exclusive upper bound, at most max_limit.
+     * @param[in] threads The maximum number of threads, 0 for one per hardware thread.
+     *
+     * @throws std::invalid_argument If limit exceeds max_limit.
+     * @throws std::system_error If the file cannot be created, mapped, synced or renamed.
+     */
+    static void write(const std::string &path, std::uint64_t limit = max_limit, unsigned threads = 0);
+
+  private:
+    // Bit of each residue modulo 30 within a table byte, zero for residues sharing a factor with 30
+    static constexpr std::array<std::uint8_t, 30> wheel_bits_ = {
+        0, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 4, 0, 8, 0, 0, 0, 16, 0, 32, 0, 0, 0, 64, 0, 0, 0, 0, 0, 128,
+    };
+
+    void *map_ = nullptr;
+    std::size_t size_ = 0;
+    const std::uint8_t *bytes_ = nullptr;
+    std::uint64_t limit_ = 0;
+  };
+
+} // namespace cpp_concept
@@ -0,0 +1,128 @@
+#include "foo/range_max.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+namespace cpp_concept
+{
+
+  namespace
+  {
+
+    void check_range(std::size_t first, std::size_t last, std::size_t size)
+    {
+      if (first >= last)
+      {
+        throw std::invalid_argument("Range cannot be empty");
+      }
+
+      if (last > size)
+      {
+        throw std::out_of_range("Range exceeds the indexed sequence");
+      }
+    }
+
+  } // namespace
+
+  RangeMax::RangeMax(std::span<const int> values)
+      : values_(values.begin(), values.end()), masks_(values.size())
+  {
+    const std::size_t n = values_.size();
+    blocks_ = (n + block_size - 1) >> block_bits;
+
+    // Monotonic stack per block: bit j of masks_[i] is set while values_[base + j]
+    // is not exceeded by any later value up to i, so the lowest set bit at or
+    // above an offset locates the maximum from that offset up to i
+    std::uint32_t stack = 0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      const std::size_t base = i & ~(block_size - 1);
+      if (i == base)
+      {
+        stack = 0;
+      }
+
+      while (stack != 0)
+      {
+        const int top = 31 - std::countl_zero(stack);
+        if (values_[base + static_cast<std::size_t>(top)] >= values_[i])
+        {
+          break;
+        }
+        stack &= ~(std::uint32_t{1} << top);
+      }
+
+      stack |= std::uint32_t{1} << (i & (block_size - 1));
+      masks_[i] = stack;
+    }
+
+    // Level j holds the maxima of 2^j consecutive blocks; levels are stored
+    // one after another so each query reads two entries of the same level
+    const std::size_t levels = blocks_ == 0 ? 0 : static_cast<std::size_t>(std::bit_width(blocks_));
+    table_.resize(levels * blocks_);
+    for (std::size_t b = 0; b < blocks_; ++b)
+    {
+      const std::size_t first = b << block_bits;
+      table_[b] = block_max(first, std::min(first + block_size, n) - 1);
+    }
+
+    for (std::size_t level = 1; level < levels; ++level)
+    {
+      const std::size_t half = std::size_t{1} << (level - 1);
+      const int *previous = table_.data() + (level - 1) * blocks_;
+      int *current = table_.data() + level * blocks_;
+      for (std::size_t b = 0; b + (half << 1) <= blocks_; ++b)
+      {
+        current[b] = std::max(previous[b], previous[b + half]);
+      }
+    }
+  }
+
+  int RangeMax::block_max(std::size_t first, std::size_t last) const noexcept
+  {
+    const std::uint32_t mask = masks_[last] & (~std::uint32_t{0} << (first & (block_size - 1)));
+    return values_[(last & ~(block_size - 1)) + static_cast<std::size_t>(std::countr_zero(mask))];
+  }
+
+  int RangeMax::max(std::size_t first, std::size_t last) const
+  {
+    check_range(first, last, values_.size());
+
+    --last;
+    const std::size_t lb = first >> block_bits;
+    const std::size_t rb = last >> block_bits;
+    if (lb == rb)
+    {
+      return block_max(first, last);
+    }
+
+    int result = std::max(block_max(first, (lb << block_bits) + block_size - 1), block_max(rb << block_bits, last));
+    if (lb + 1 < rb)
+    {
+      const std::size_t span = rb - lb - 1;
+      const auto level = static_cast<std::size_t>(std::bit_width(span) - 1);
+      const int *row = table_.data() + level * blocks_;
+      result = std::max({result, row[lb + 1], row[rb - (std::size_t{1} << level)]});
+    }
+
+    return result;
+  }
+
+  void RangeMax::max(std::span<const std::size_t> firsts, std::span<const std::size_t> lasts,
+                     std::span<int> out) const
+  {
+    if (firsts.size() != lasts.size() || firsts.size() != out.size())
+    {
+      throw std::invalid_argument("Span sizes must match");
+    }
+
+    for (std::size_t i = 0; i < out.size(); ++i)
+    {
+      out[i] = max(firsts[i], lasts[i]);
+    }
+  }
+
+} // namespace cpp_concept
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/**
+ * @file foo/range_max.hpp
+ * @brief Header file for the RangeMax class answering range-maximum queries.
+ *
+ * This file defines the RangeMax class within the cpp_concept namespace. A
+ * RangeMax is built once from an immutable sequence and then answers the
+ * maximum of any sub-range in constant time, instead of a Foo::find_max()
+ * scan per query.
+ *
+ * @author Sentenz
+ * @copyright Copyright (c) 2026 Sentenz
+ * @license SPDX-License-Identifier: Apache-2.0
+ */
+
+namespace cpp_concept
+{
+
+  /**
+   * @brief Answers maximum queries over sub-ranges of a fixed sequence.
+   *
+   * The sequence is split into blocks of 32 values. A sparse table over the
+   * block maxima answers whole-block spans with two lookups, and one 32-bit
+   * mask per position encodes the monotonic stack of its block, so the
+   * partial blocks at either end are answered with a shift and a
+   * count-trailing-zeros. Every query is O(1) after an O(n) build, and the
+   * index needs about 8 bytes per value plus the table over n / 32 blocks.
+   *
+   * Ranges are half-open, [first, last), like the iterator ranges of the
+   * standard library.
+   *
+   * @note Thread safety: A RangeMax is immutable after construction and safe
+   *       for concurrent read-only access from multiple threads.
+   *
+   * @see Foo::find_max()
+   *
+   * @code
+   * std::vector<int> values = {3, 1, 4, 1, 5, 9, 2, 6};
+   * RangeMax index(values);
+   * int a = index.max(0, 4);  // Returns 4
+   * int b = index.max(2, 8);  // Returns 9
+   * @endcode
+   *
+   * @since 1.1
+   */
+  class RangeMax
+  {
+  public:
+    /**
+     * @brief Builds the index over a copy of a sequence.
+     *
+     * @param[in] values The sequence to index.
+     */
+    explicit RangeMax(std::span<const int> values);
+
+    /**
+     * @brief Returns the length of the indexed sequence.
+     *
+     * @return The number of indexed values.
+     */
+    std::size_t size() const noexcept
+    {
+      return values_.size();
+    }
+
+    /**
+     * @brief Finds the maximum of a sub-range.
+     *
+     * @param[in] first Index of the first value in the range.
+     * @param[in] last Index one past the last value in the range.
+     *
+     * @return The same value as Foo::find_max() over values[first, last).
+     *
+     * @throws std::invalid_argument If the range is empty.
+     * @throws std::out_of_range If last exceeds size().
+     *
+     * @pre first < last && last <= size()
+     */
+    int max(std::size_t first, std::size_t last) const;
+
+    /**
+     * @brief Finds the maxima of many sub-ranges.
+     *
+     * Query i covers [firsts[i], lasts[i]).
+     *
+     * @param[in] firsts Index of the first value of each range.
+     * @param[in] lasts Index one past the last value of each range.
+     * @param[out] out The destination span receiving one maximum per range.
+     *
+     * @throws std::invalid_argument If the spans differ in size or any range is empty.
+     * @throws std::out_of_range If any range ends beyond size().
+     *
+     * @pre firsts.size() == lasts.size() && lasts.size() == out.size()
+     */
+    void max(std::span<const std::size_t> firsts, std::span<const std::size_t> lasts, std::span<int> out) const;
+
+  private:
+    static constexpr std::size_t block_bits = 5;
+    static constexpr std::size_t block_size = std::size_t{1} << block_bits;
+
+    // Maximum of values[first, last] for first and last in the same block
+    int block_max(std::size_t first, std::size_t last) const noexcept;
+
+    std::vector<int> values_;
+    std::vector<std::uint32_t> masks_;
+    std::vector<int> table_;
+    std::size_t blocks_ = 0;
+  };
+
+} // namespace cpp_concept
@@ -0,0 +1,275 @@
+#include "foo/sieve.hpp"
+#include "foo/modular.hpp"
+#include "foo/parallel.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+
+namespace cpp_concept::sieve
+{
+
+  namespace
+  {
+
+    // The eight residues coprime to 30; bit i of a byte stands for residues[i]
+    constexpr std::array<std::uint8_t, 8> residues = {1, 7, 11, 13, 17, 19, 23, 29};
+
+    // Distance from residues[i] to the next residue coprime to 30
+    constexpr std::array<std::uint8_t, 8> gaps = {6, 4, 2, 4, 2, 4, 6, 2};
+
+    // Bit of each residue modulo 30, zero for residues sharing a factor with 30
+    constexpr auto bits = []
+    {
+      std::array<std::uint8_t, 30> table{};
+      for (std::size_t i = 0; i < residues.size(); ++i)
+      {
+        table[residues[i]] = static_cast<std::uint8_t>(1U << i);
+      }
+
+      return table;
+    }();
+
+    // Index of the smallest residue coprime to 30 that is at least r
+    constexpr auto wheel_from = []
+    {
+      std::array<std::uint8_t, 30> table{};
+      for (std::size_t r = 0; r < table.size(); ++r)
+      {
+        std::size_t i = 0;
+        while (residues[i] < r)
+        {
+          ++i;
+        }
+        table[r] = static_cast<std::uint8_t>(i);
+      }
+
+      return table;
+    }();
+
+  } // namespace
+
+  std::vector<std::uint32_t> base_primes(std::uint64_t last)
+  {
+    if (last < 50)
+    {
+      return {};
+    }
+
+    // The base primes are sieved segment by segment on the wheel as well,
+    // from the base primes of their own bound, so no bit array of sqrt(last)
+    // entries is held and each level of the recursion is a square root smaller
+    const std::uint64_t bound = modular::isqrt(last - 1) + 1;
+    const std::vector<std::uint32_t> inner = base_primes(bound);
+
+    // pi(x) < 1.25506 x / ln(x) for x > 1 (Rosser and Schoenfeld), so the
+    // hundred million primes near the limit are never copied by a regrowth
+    std::vector<std::uint32_t> primes;
+    primes.reserve(static_cast<std::size_t>(1.25506 * static_cast<double>(bound) / std::log(static_cast<double>(bound))));
+    std::vector<std::uint64_t> run;
+    Segments segments(inner, 7, bound);
+    while (segments.next())
+    {
+      run.clear();
+      segments.collect(run);
+      for (const auto p : run)
+      {
+        primes.push_back(static_cast<std::uint32_t>(p));
+      }
+    }
+
+    return primes;
+  }
+
+  // S(v) counts the integers in [2, v] that are prime or have no prime factor
+  // below p. Sieving by each prime p in turn applies
+  //   S(v) -= S(v / p) - S(p - 1)   for every v >= p^2,
+  // and only the values v = x / i are ever needed, held in two arrays of
+  // sqrt(x) entries: small[v] for v <= r, large[i] = S(x / i) for i <= r.
+  std::uint64_t prime_pi(std::uint64_t x, unsigned threads)
+  {
+    if (x < 2)
+    {
+      return 0;
+    }
+
+    const std::uint64_t r = modular::isqrt(x);
+    std::vector<std::uint64_t> small(r + 1);
+    std::vector<std::uint64_t> large(r + 1);
+    for (std::uint64_t v = 1; v <= r; ++v)
+    {
+      small[v] = v - 1;
+      large[v] = x / v - 1;
+    }
+
+    // Resolved once, since querying the hardware costs more than a small pass
+    const unsigned workers = parallel::resolve(threads);
+
+    // Updated values are staged here while a prime is processed in parallel,
+    // because the recurrence reads entries the same pass overwrites
+    std::vector<std::uint64_t> staged;
+
+    for (std::uint64_t p = 2; p <= r; ++p)
+    {
+      if (small[p] == small[p - 1])
+      {
+        continue;
+      }
+
+      const std::uint64_t below = small[p - 1];
+      const std::uint64_t square = p * p;
+      const std::uint64_t xp = x / p;
+      const std::uint64_t large_count = std::min(r, x / square);
+      const std::uint64_t small_count = square <= r ? r - square + 1 : 0;
+
+      // x / (i * p) is a large entry while i * p <= r, and below r + 1 otherwise
+      auto next_large = [&](std::uint64_t i)
+      {
+        const std::uint64_t d = i * p;
+        return large[i] - ((d <= r ? large[d] : small[xp / i]) - below);
+      };
+      auto next_small = [&](std::uint64_t v) { return small[v] - (small[v / p] - below); };
+
+      const std::uint64_t work = large_count + small_count;
+      const std::size_t chunks = parallel::chunk_count(work, workers, std::size_t{1} << 16);
+      if (chunks == 1)
+      {
+        // Ascending i reads large[i * p] before it is updated, and descending v
+        // reads small[v / p] before it is updated, so one pass suffices
+        for (std::uint64_t i = 1; i <= large_count; ++i)
+        {
+          large[i] = next_large(i);
+        }
+        for (std::uint64_t v = r; v >= square; --v)
+        {
+          small[v] = next_small(v);
+        }
+        continue;
+      }
+
+      staged.resize(work);
+      parallel::for_each_chunk(work, chunks,
+                               [&](std::size_t, std::size_t first, std::size_t last)
+                               {
+                                 for (std::size_t k = first; k < last; ++k)
+                                 {
+                                   staged[k] = k < large_count ? next_large(k + 1) : next_small(square + k - large_count);
+                                 }
+                               });
+      std::copy_n(staged.begin(), large_count, large.begin() + 1);
+      std::copy_n(staged.begin() + static_cast<std::ptrdiff_t>(large_count), small_count,
+                  small.begin() + static_cast<std::ptrdiff_t>(square));
+    }
+
+    return large[1];
+  }
+
+  Segments::Segments(std::span<const std::uint32_t> primes, std::uint64_t first, std::uint64_t last)
+      : bytes_(segment_bytes), first_(first), last_(last), low_(first - first % 30), high_(low_)
+  {
+    for (const auto p : primes)
+    {
+      const std::uint64_t square = std::uint64_t{p} * p;
+      if (square >= last)
+      {
+        break;
+      }
+
+      // Smallest multiple p * m >= max(p^2, low_) with m coprime to 30
+      std::uint64_t m = std::max<std::uint64_t>(p, (low_ + p - 1) / p);
+      const std::uint8_t wheel = wheel_from[m % 30];
+      m += residues[wheel] - m % 30;
+      multiples_.push_back({m * p, p, wheel});
+    }
+  }
+
+  bool Segments::next()
+  {
+    low_ = high_;
+    if (low_ >= last_)
+    {
+      return false;
+    }
+
+    high_ = std::min(low_ + segment_span, last_ + (30 - last_ % 30) % 30);
+    const std::size_t size = static_cast<std::size_t>((high_ - low_) / 30);
+    std::fill_n(bytes_.begin(), size, std::uint8_t{0xFF});
+
+    std::uint8_t *bytes = bytes_.data();
+    for (auto &multiple : multiples_)
+    {
+      // Multiples start at p^2 and primes ascend, so no later prime reaches this segment
+      if (std::uint64_t{multiple.prime} * multiple.prime >= high_)
+      {
+        break;
+      }
+
+      std::uint64_t value = multiple.value;
+      std::uint32_t wheel = multiple.wheel;
+      while (value < high_)
+      {
+        const std::uint64_t offset = value - low_;
+        bytes[offset / 30] &= static_cast<std::uint8_t>(~bits[offset % 30]);
+        value += std::uint64_t{multiple.prime} * gaps[wheel];
+        wheel = (wheel + 1) & 7;
+      }
+      multiple.value = value;
+      multiple.wheel = wheel;
+    }
+
+    // Clear 1 and every integer outside [first_, last_) in the edge bytes
+    for (const std::size_t i : {std::size_t{0}, size - 1})
+    {
+      for (std::size_t bit = 0; bit < residues.size(); ++bit)
+      {
+        const std::uint64_t value = low_ + 30 * i + residues[bit];
+        if (value < first_ || value >= last_ || value == 1)
+        {
+          bytes[i] &= static_cast<std::uint8_t>(~(1U << bit));
+        }
+      }
+    }
+
+    return true;
+  }
+
+  std::size_t Segments::count() const noexcept
+  {
+    const std::size_t size = static_cast<std::size_t>((high_ - low_) / 30);
+
+    // Count eight bytes per popcount
+    std::size_t total = 0;
+    std::size_t i = 0;
+    for (; i + 8 <= size; i += 8)
+    {
+      std::uint64_t word;
+      std::copy_n(bytes_.data() + i, 8, reinterpret_cast<std::uint8_t *>(&word));
+      total += static_cast<std::size_t>(std::popcount(word));
+    }
+    for (; i < size; ++i)
+    {
+      total += static_cast<std::size_t>(std::popcount(bytes_[i]));
+    }
+
+    return total;
+  }
+
+  std::span<const std::uint8_t> Segments::bytes() const noexcept
+  {
+    return {bytes_.data(), static_cast<std::size_t>((high_ - low_) / 30)};
+  }
+
+  void Segments::collect(std::vector<std::uint64_t> &out) const
+  {
+    const std::size_t size = static_cast<std::size_t>((high_ - low_) / 30);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      for (unsigned byte = bytes_[i]; byte != 0; byte &= byte - 1)
+      {
+        out.push_back(low_ + 30 * i + residues[static_cast<std::size_t>(std::countr_zero(byte))]);
+      }
+    }
+  }
+
+} // namespace cpp_concept::sieve
@@ -0,0 +1,116 @@
+#pragma once
+
+/**
+ * @file foo/sieve.hpp
+ * @brief Internal segmented sieve of Eratosthenes on a mod-30 wheel.
+ *
+ * This header is private to the foo library. It enumerates the primes of a
+ * half-open range one cache-sized segment at a time. Each byte of a segment
+ * stands for 30 consecutive integers, one bit for each residue coprime to
+ * 30, so multiples of 2, 3 and 5 are never stored or crossed off.
+ *
+ * @author Sentenz
+ * @copyright Copyright (c) 2026 Sentenz
+ * @license SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace cpp_concept::sieve
+{
+
+  /// Exclusive upper bound accepted for sieved ranges, leaving headroom for the wheel arithmetic.
+  inline constexpr std::uint64_t limit = std::uint64_t{1} << 62;
+
+  /// Bytes per segment, sized to stay resident in the L1 data cache.
+  inline constexpr std::size_t segment_bytes = std::size_t{1} << 15;
+
+  /// Integers covered by one segment.
+  inline constexpr std::uint64_t segment_span = std::uint64_t{30} * segment_bytes;
+
+  /**
+   * @brief Returns the sieving primes for a range ending at last.
+   *
+   * The primes are themselves sieved with Segments, from the sieving primes
+   * of \f$\sqrt{last}\f$, so only they and one segment are held.
+   *
+   * @param[in] last The exclusive upper bound of the range to sieve.
+   *
+   * @return Every prime p with \f$7 \le p\f$ and \f$p^2 < last\f$, in increasing order.
+   */
+  std::vector<std::uint32_t> base_primes(std::uint64_t last);
+
+  /**
+   * @brief Counts the primes up to x with the Lucy_Hedgehog recurrence.
+   *
+   * @param[in] x The inclusive upper bound, at most limit.
+   * @param[in] threads The maximum number of threads, 0 for one per hardware thread.
+   *
+   * @return \f$\pi(x)\f$.
+   */
+  std::uint64_t prime_pi(std::uint64_t x, unsigned threads);
+
+  /**
+   * @brief Sieves consecutive segments of a range.
+   *
+   * Keeps the next multiple of every sieving prime between segments, so a
+   * run of adjacent segments costs one division per prime in total.
+   */
+  class Segments
+  {
+  public:
+    /**
+     * @brief Prepares sieving of [first, last).
+     *
+     * @param[in] primes The result of base_primes() for a bound of at least last.
+     * @param[in] first The inclusive lower bound.
+     * @param[in] last The exclusive upper bound, at most limit.
+     */
+    Segments(std::span<const std::uint32_t> primes, std::uint64_t first, std::uint64_t last);
+
+    /**
+     * @brief Sieves the next segment.
+     *
+     * @return False once the range is exhausted.
+     */
+    bool next();
+
+    /**
+     * @brief Counts the primes of the current segment that are at least 7.
+     */
+    std::size_t count() const noexcept;
+
+    /**
+     * @brief Appends the primes of the current segment that are at least 7, in increasing order.
+     */
+    void collect(std::vector<std::uint64_t> &out) const;
+
+    /**
+     * @brief Returns the wheel bytes of the current segment, one per 30 integers.
+     *
+     * Byte i covers the integers from 30 * i past the lower bound of the
+     * segment, which is a multiple of 30. Integers outside the range and
+     * primes below 7 are left clear.
+     */
+    std::span<const std::uint8_t> bytes() const noexcept;
+
+  private:
+    struct Multiple
+    {
+      std::uint64_t value;
+      std::uint32_t prime;
+      std::uint32_t wheel;
+    };
+
+    std::vector<Multiple> multiples_;
+    std::vector<std::uint8_t> bytes_;
+    std::uint64_t first_;
+    std::uint64_t last_;
+    std::uint64_t low_;
+    std::uint64_t high_;
+  };
+
+} // namespace cpp_concept::sieve
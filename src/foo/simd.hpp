@@ -0,0 +1,95 @@
+#pragma once
+
+/**
+ * @file foo/simd.hpp
+ * @brief Internal helpers for runtime SIMD dispatch of the Foo batch kernels.
+ *
+ * This header is private to the foo library. It detects the widest x86 vector
+ * extension supported by the host once, and provides the attribute macro used
+ * to compile individual kernels for that extension without raising the
+ * baseline architecture of the whole library.
+ *
+ * @author Sentenz
+ * @copyright Copyright (c) 2026 Sentenz
+ * @license SPDX-License-Identifier: Apache-2.0
+ */
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define CPP_CONCEPT_SIMD_X86 1
+#include <immintrin.h>
+#else
+#define CPP_CONCEPT_SIMD_X86 0
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define CPP_CONCEPT_TARGET(isa) __attribute__((target(isa)))
+#else
+#define CPP_CONCEPT_TARGET(isa)
+#endif
+
+// NOTE GCC 12 reports false uninitialized warnings inside the AVX-512 intrinsics (GCC PR 105593). They fire
+// where the intrinsics are inlined, so the brackets go around the kernel definitions, not around the include
+#if defined(__GNUC__) && !defined(__clang__)
+#define CPP_CONCEPT_AVX512_BEGIN \
+  _Pragma("GCC diagnostic push") \
+  _Pragma("GCC diagnostic ignored \"-Wuninitialized\"") \
+  _Pragma("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+#define CPP_CONCEPT_AVX512_END _Pragma("GCC diagnostic pop")
+#else
+#define CPP_CONCEPT_AVX512_BEGIN
+#define CPP_CONCEPT_AVX512_END
+#endif
+
+namespace cpp_concept::simd
+{
+
+  /**
+   * @brief Vector instruction set selected for a batch kernel.
+   *
+   * Enumerators are ordered by register width, so a kernel may be chosen
+   * with a simple `>=` comparison against the detected level.
+   */
+  enum class Isa
+  {
+    scalar,
+    sse2,
+    avx2,
+    avx512
+  };
+
+  /**
+   * @brief Returns the widest instruction set supported by the host CPU.
+   *
+   * The CPU is queried on the first call only; later calls return the cached
+   * result.
+   *
+   * @return The detected instruction set.
+   *
+   * @note MSVC builds report at most SSE2, the x86-64 baseline.
+   */
+  inline Isa isa() noexcept
+  {
+    static const Isa detected = []
+    {
+#if CPP_CONCEPT_SIMD_X86 && (defined(__GNUC__) || defined(__clang__))
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+      {
+        return Isa::avx512;
+      }
+      if (__builtin_cpu_supports("avx2"))
+      {
+        return Isa::avx2;
+      }
+      return Isa::sse2;
+#elif CPP_CONCEPT_SIMD_X86
+      return Isa::sse2;
+#else
+      return Isa::scalar;
+#endif
+    }();
+
+    return detected;
+  }
+
+} // namespace cpp_concept::simd
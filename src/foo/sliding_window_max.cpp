@@ -0,0 +1,55 @@
+#include "foo/sliding_window_max.hpp"
+
+#include <bit>
+#include <stdexcept>
+
+namespace cpp_concept
+{
+
+  // NOTE The ring buffer is rounded up to a power of two so that wrapping an
+  // index is a mask instead of a modulo
+  SlidingWindowMax::SlidingWindowMax(std::size_t window)
+      : window_(window)
+  {
+    if (window == 0)
+    {
+      throw std::invalid_argument("Window cannot be empty");
+    }
+
+    const std::size_t capacity = std::bit_ceil(window);
+    mask_ = capacity - 1;
+    values_.resize(capacity);
+    indices_.resize(capacity);
+  }
+
+  void SlidingWindowMax::push(std::span<const int> samples, std::span<int> out)
+  {
+    if (samples.size() != out.size())
+    {
+      throw std::invalid_argument("Span sizes must match");
+    }
+
+    for (std::size_t i = 0; i < samples.size(); ++i)
+    {
+      out[i] = push(samples[i]);
+    }
+  }
+
+  int SlidingWindowMax::max() const
+  {
+    if (count_ == 0)
+    {
+      throw std::invalid_argument("Window cannot be empty");
+    }
+
+    return values_[head_];
+  }
+
+  void SlidingWindowMax::clear() noexcept
+  {
+    head_ = 0;
+    count_ = 0;
+    next_ = 0;
+  }
+
+} // namespace cpp_concept
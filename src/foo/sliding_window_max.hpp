@@ -0,0 +1,151 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/**
+ * @file foo/sliding_window_max.hpp
+ * @brief Header file for the SlidingWindowMax class tracking a streaming maximum.
+ *
+ * This file defines the SlidingWindowMax class within the cpp_concept
+ * namespace. A SlidingWindowMax consumes an unbounded stream of samples and
+ * reports the maximum of the most recent ones after every sample, without
+ * rescanning the window as a Foo::find_max() call per sample would.
+ *
+ * @author Sentenz
+ * @copyright Copyright (c) 2026 Sentenz
+ * @license SPDX-License-Identifier: Apache-2.0
+ */
+
+namespace cpp_concept
+{
+
+  /**
+   * @brief Maximum over the last W samples of a stream.
+   *
+   * Keeps a monotonic deque of the samples that may still become the window
+   * maximum, with values decreasing from front to back. Each push drops the
+   * expired front entry and every back entry the new sample dominates, so a
+   * push costs amortized O(1). The deque lives in a ring buffer sized at
+   * construction, so pushing never allocates.
+   *
+   * @note Thread safety: Not thread-safe; concurrent access requires external
+   *       synchronization.
+   *
+   * @see Foo::find_max()
+   *
+   * @code
+   * SlidingWindowMax window(3);
+   * window.push(4);  // Returns 4
+   * window.push(1);  // Returns 4
+   * window.push(2);  // Returns 4
+   * window.push(0);  // Returns 2, the 4 has left the window
+   * @endcode
+   *
+   * @since 1.1
+   */
+  class SlidingWindowMax
+  {
+  public:
+    /**
+     * @brief Allocates the ring buffer for a window length.
+     *
+     * @param[in] window The number of most recent samples covered by max().
+     *
+     * @throws std::invalid_argument If window is zero.
+     *
+     * @pre window > 0
+     */
+    explicit SlidingWindowMax(std::size_t window);
+
+    /**
+     * @brief Returns the window length.
+     *
+     * @return The number of samples the window covers once full.
+     */
+    std::size_t window() const noexcept
+    {
+      return window_;
+    }
+
+    /**
+     * @brief Returns the number of samples currently in the window.
+     *
+     * @return min(window(), number of samples pushed since construction or clear()).
+     */
+    std::size_t size() const noexcept
+    {
+      return next_ < window_ ? static_cast<std::size_t>(next_) : window_;
+    }
+
+    /**
+     * @brief Appends a sample and returns the new window maximum.
+     *
+     * @param[in] sample The newest sample of the stream.
+     *
+     * @return The maximum of the last min(window(), size()) samples, including sample.
+     */
+    int push(int sample) noexcept
+    {
+      // Expire the front first, so the deque never holds more than window_ entries
+      if (count_ != 0 && indices_[head_] + window_ <= next_)
+      {
+        head_ = (head_ + 1) & mask_;
+        --count_;
+      }
+
+      while (count_ != 0 && values_[(head_ + count_ - 1) & mask_] <= sample)
+      {
+        --count_;
+      }
+
+      const std::size_t tail = (head_ + count_) & mask_;
+      values_[tail] = sample;
+      indices_[tail] = next_++;
+      ++count_;
+
+      return values_[head_];
+    }
+
+    /**
+     * @brief Appends samples in order and records the maximum after each one.
+     *
+     * @param[in] samples The new samples, oldest first.
+     * @param[out] out The destination span; out[i] receives the window maximum after samples[i].
+     *
+     * @throws std::invalid_argument If the spans differ in size.
+     *
+     * @pre samples.size() == out.size()
+     * @note out may alias samples exactly, but must not partially overlap it.
+     */
+    void push(std::span<const int> samples, std::span<int> out);
+
+    /**
+     * @brief Returns the maximum of the current window.
+     *
+     * @return The maximum of the last size() samples.
+     *
+     * @throws std::invalid_argument If no sample has been pushed yet.
+     *
+     * @pre size() > 0
+     */
+    int max() const;
+
+    /**
+     * @brief Discards every sample, keeping the window length and buffer.
+     */
+    void clear() noexcept;
+
+  private:
+    std::size_t window_;
+    std::size_t mask_;
+    std::vector<int> values_;
+    std::vector<std::uint64_t> indices_;
+    std::size_t head_ = 0;
+    std::size_t count_ = 0;
+    std::uint64_t next_ = 0;
+  };
+
+} // namespace cpp_concept
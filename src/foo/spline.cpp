@@ -0,0 +1,236 @@
+#include "foo/spline.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <stdexcept>
+
+namespace cpp_concept
+{
+
+  namespace
+  {
+
+    // Boundary rows of the tridiagonal system; natural ends pin the second
+    // derivative to zero, clamped ends match the given slopes
+    struct Ends
+    {
+      bool clamped;
+      double first_slope;
+      double last_slope;
+    };
+
+    // Second derivatives at the knots from the continuity of the first
+    // derivative, by the Thomas algorithm. The system is strictly diagonally
+    // dominant, so the elimination needs no pivoting
+    std::vector<double> second_derivatives(std::span<const double> x, std::span<const double> y, const Ends &ends)
+    {
+      const std::size_t n = x.size();
+      std::vector<double> upper(n);
+      std::vector<double> second(n);
+
+      auto h = [&](std::size_t i)
+      {
+        return x[i + 1] - x[i];
+      };
+      auto slope = [&](std::size_t i)
+      {
+        return (y[i + 1] - y[i]) / h(i);
+      };
+
+      // Row 0, already divided by its diagonal
+      if (ends.clamped)
+      {
+        upper[0] = 0.5;
+        second[0] = 3 * (slope(0) - ends.first_slope) / h(0);
+      }
+
+      for (std::size_t i = 1; i + 1 < n; ++i)
+      {
+        const double lower = h(i - 1);
+        const double pivot = 2 * (h(i - 1) + h(i)) - lower * upper[i - 1];
+        upper[i] = h(i) / pivot;
+        second[i] = (6 * (slope(i) - slope(i - 1)) - lower * second[i - 1]) / pivot;
+      }
+
+      if (ends.clamped)
+      {
+        const double lower = h(n - 2);
+        const double pivot = 2 * h(n - 2) - lower * upper[n - 2];
+        second[n - 1] = (6 * (ends.last_slope - slope(n - 2)) - lower * second[n - 2]) / pivot;
+      }
+
+      for (std::size_t i = n - 1; i-- > 0;)
+      {
+        second[i] -= upper[i] * second[i + 1];
+      }
+
+      return second;
+    }
+
+    inline void prefetch(const void *address) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+      __builtin_prefetch(address);
+#else
+      static_cast<void>(address);
+#endif
+    }
+
+    // Lays out sorted[] in Eytzinger order by an in-order walk of the
+    // implicit tree rooted at node k, whose children are 2k and 2k + 1
+    std::size_t fill(std::span<const double> sorted, std::vector<double> &tree, std::vector<std::size_t> &ranks,
+                     std::size_t i, std::size_t k)
+    {
+      if (k < tree.size())
+      {
+        i = fill(sorted, tree, ranks, i, 2 * k);
+        tree[k] = sorted[i];
+        ranks[k] = i++;
+        i = fill(sorted, tree, ranks, i, 2 * k + 1);
+      }
+
+      return i;
+    }
+
+  } // namespace
+
+  Spline::Spline(std::span<const double> x, std::span<const double> y)
+  {
+    validate(x, y);
+    index();
+    build(y, second_derivatives(x, y, {false, 0, 0}));
+  }
+
+  Spline::Spline(std::span<const double> x, std::span<const double> y, double first_slope, double last_slope)
+  {
+    validate(x, y);
+    index();
+    build(y, second_derivatives(x, y, {true, first_slope, last_slope}));
+  }
+
+  void Spline::validate(std::span<const double> x, std::span<const double> y)
+  {
+    if (x.size() != y.size())
+    {
+      throw std::invalid_argument("Span sizes must match");
+    }
+    if (x.size() < 2)
+    {
+      throw std::invalid_argument("At least two knots are required");
+    }
+    for (std::size_t i = 0; i + 1 < x.size(); ++i)
+    {
+      // Negated, so a NaN knot is rejected too
+      if (!(x[i] < x[i + 1]))
+      {
+        throw std::invalid_argument("Knots must be strictly increasing");
+      }
+    }
+
+    knots_ = x.size();
+    coefficients_.resize(knots_ + 4 * (knots_ - 1));
+    std::copy(x.begin(), x.end(), coefficients_.begin());
+  }
+
+  void Spline::index()
+  {
+    const double *x = coefficients_.data();
+    const double step = (x[knots_ - 1] - x[0]) / static_cast<double>(knots_ - 1);
+
+    // Within a quarter step of the grid, the scaled offset of any point is
+    // at most one interval off, which interval() corrects exactly
+    uniform_ = true;
+    for (std::size_t i = 1; i + 1 < knots_ && uniform_; ++i)
+    {
+      uniform_ = std::abs(x[i] - (x[0] + static_cast<double>(i) * step)) <= 0.25 * step;
+    }
+
+    if (uniform_)
+    {
+      inverse_step_ = 1 / step;
+      return;
+    }
+
+    // Node 0 is unused; ranks_[0] answers points past every interior knot
+    tree_.assign(knots_ - 1, 0);
+    ranks_.assign(knots_ - 1, knots_ - 2);
+    fill(std::span(x + 1, knots_ - 2), tree_, ranks_, 0, 1);
+  }
+
+  void Spline::build(std::span<const double> y, const std::vector<double> &second)
+  {
+    const std::size_t segments = knots_ - 1;
+    const double *x = coefficients_.data();
+    double *a = coefficients_.data() + knots_;
+    double *b = a + segments;
+    double *c = b + segments;
+    double *d = c + segments;
+
+    for (std::size_t i = 0; i < segments; ++i)
+    {
+      const double h = x[i + 1] - x[i];
+      a[i] = y[i];
+      b[i] = (y[i + 1] - y[i]) / h - h * (2 * second[i] + second[i + 1]) / 6;
+      c[i] = second[i] / 2;
+      d[i] = (second[i + 1] - second[i]) / (6 * h);
+    }
+  }
+
+  std::size_t Spline::interval(double x) const noexcept
+  {
+    // Both paths count the interior knots at or below x, which clamps the
+    // result to [0, knots_ - 2] and sends NaN to the first interval
+    if (uniform_)
+    {
+      const double *knots = coefficients_.data();
+      const double last = static_cast<double>(knots_ - 2);
+      const double offset = (x - knots[0]) * inverse_step_;
+      std::size_t i = offset > 0 ? static_cast<std::size_t>(std::min(offset, last)) : 0;
+      i -= static_cast<std::size_t>(i > 0 && x < knots[i]);
+      i += static_cast<std::size_t>(i + 2 < knots_ && x >= knots[i + 1]);
+      return i;
+    }
+
+    // Descend to the first interior knot above x, going right on <=. The
+    // eight nodes three levels below k, 8k to 8k + 7, are adjacent, so one
+    // prefetch fetches them while the next levels are compared
+    const double *tree = tree_.data();
+    const std::size_t size = tree_.size();
+    std::size_t k = 1;
+    while (k < size)
+    {
+      prefetch(tree + 8 * k);
+      k = 2 * k + static_cast<std::size_t>(tree[k] <= x);
+    }
+
+    // The right turns taken since that knot are the trailing ones of k
+    k >>= std::countr_one(k) + 1;
+    return ranks_[k];
+  }
+
+  double Spline::operator()(double x) const noexcept
+  {
+    const std::size_t segments = knots_ - 1;
+    const double *knots = coefficients_.data();
+    const double *a = knots + knots_;
+
+    const std::size_t i = interval(x);
+    const double t = x - knots[i];
+    return a[i] + t * (a[i + segments] + t * (a[i + 2 * segments] + t * a[i + 3 * segments]));
+  }
+
+  void Spline::evaluate(std::span<const double> x, std::span<double> out) const
+  {
+    if (x.size() != out.size())
+    {
+      throw std::invalid_argument("Span sizes must match");
+    }
+
+    for (std::size_t i = 0; i < x.size(); ++i)
+    {
+      out[i] = (*this)(x[i]);
+    }
+  }
+
+} // namespace cpp_concept
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+/**
+ * @file foo/spline.hpp
+ * @brief Header file for the Spline class interpolating many knots with cubic polynomials.
+ *
+ * This file defines the Spline class within the cpp_concept namespace. A
+ * Spline validates its knots and solves for its coefficients once, so every
+ * later evaluation is a knot search and a cubic polynomial, instead of a
+ * Foo::spline() call that re-validates its two points each time.
+ *
+ * @author Sentenz
+ * @copyright Copyright (c) 2026 Sentenz
+ * @license SPDX-License-Identifier: Apache-2.0
+ */
+
+namespace cpp_concept
+{
+
+  /**
+   * @brief Cubic spline through a fixed set of knots.
+   *
+   * On each interval \f$[x_i, x_{i+1})\f$ the spline is the cubic
+   * \f$a_i + b_i t + c_i t^2 + d_i t^3\f$ with \f$t = x - x_i\f$; together the
+   * pieces pass through every knot with continuous first and second
+   * derivatives. The constructor solves the tridiagonal system for the
+   * second derivatives in O(n), with either natural ends (zero second
+   * derivative) or clamped ends (given first derivatives). The knots and the
+   * four coefficient arrays live back to back in one allocation, so an
+   * evaluation touches one entry of each array and a batch walks them
+   * contiguously.
+   *
+   * Finding the interval dominates the cost of an evaluation once the knots
+   * outgrow the cache, so the constructor also indexes them. Knots within a
+   * quarter step of an evenly spaced grid are located in O(1) from the
+   * scaled offset, corrected by at most one interval. Any other knots are
+   * copied into Eytzinger (breadth-first) order, where a branchless descent
+   * prefetches the nodes three levels ahead; the top of the tree stays in
+   * cache, and independent points overlap their misses.
+   *
+   * @note Outside \f$[x_0, x_{n-1}]\f$ the spline extrapolates with the cubic
+   *       of the nearest interval.
+   * @note Thread safety: A Spline is immutable after construction and safe for
+   *       concurrent read-only access from multiple threads.
+   *
+   * @see Foo::spline()
+   *
+   * @code
+   * std::vector<double> x = {0, 1, 2};
+   * std::vector<double> y = {0, 1, 0};
+   * Spline natural(x, y);
+   * double a = natural(0.5);         // Returns 0.6875
+   * Spline clamped(x, y, 0.0, 0.0);  // Flat at both ends
+   * double b = clamped(0.5);         // Returns 0.5
+   * @endcode
+   *
+   * @since 1.1
+   */
+  class Spline
+  {
+  public:
+    /**
+     * @brief Builds a natural cubic spline, whose second derivative vanishes at both ends.
+     *
+     * @param[in] x The knot positions, strictly increasing.
+     * @param[in] y The values at the knots.
+     *
+     * @throws std::invalid_argument If the spans differ in size, hold fewer
+     *         than two knots, or x is not strictly increasing.
+     *
+     * @note Two knots give the straight line of Foo::spline().
+     */
+    Spline(std::span<const double> x, std::span<const double> y);
+
+    /**
+     * @brief Builds a clamped cubic spline with given first derivatives at both ends.
+     *
+     * @param[in] x The knot positions, strictly increasing.
+     * @param[in] y The values at the knots.
+     * @param[in] first_slope The first derivative at x.front().
+     * @param[in] last_slope The first derivative at x.back().
+     *
+     * @throws std::invalid_argument If the spans differ in size, hold fewer
+     *         than two knots, or x is not strictly increasing.
+     *
+     * @note A clamped spline reproduces any cubic exactly when given its slopes.
+     */
+    Spline(std::span<const double> x, std::span<const double> y, double first_slope, double last_slope);
+
+    /**
+     * @brief Returns the number of knots.
+     *
+     * @return The number of knots, at least two.
+     */
+    std::size_t size() const noexcept
+    {
+      return knots_;
+    }
+
+    /**
+     * @brief Returns the knot positions.
+     *
+     * @return The strictly increasing knot positions.
+     */
+    std::span<const double> knots() const noexcept
+    {
+      return {coefficients_.data(), knots_};
+    }
+
+    /**
+     * @brief Evaluates the spline at one point.
+     *
+     * @param[in] x The position to evaluate at.
+     *
+     * @return The interpolated value at x, or the extrapolated one outside the knots.
+     */
+    double operator()(double x) const noexcept;
+
+    /**
+     * @brief Evaluates the spline at many points.
+     *
+     * @param[in] x The positions to evaluate at, in any order.
+     * @param[out] out The destination span receiving one value per position.
+     *
+     * @throws std::invalid_argument If the spans differ in size.
+     *
+     * @pre x.size() == out.size()
+     * @note out may alias x exactly, but must not partially overlap it.
+     */
+    void evaluate(std::span<const double> x, std::span<double> out) const;
+
+  private:
+    // Checks the knots and sizes the coefficient storage
+    void validate(std::span<const double> x, std::span<const double> y);
+
+    // Picks the uniform grid or builds the Eytzinger tree over the knots
+    void index();
+
+    // Fills the coefficients from the second derivatives at the knots
+    void build(std::span<const double> y, const std::vector<double> &second);
+
+    // Index of the interval whose cubic covers x, clamped to the end intervals
+    std::size_t interval(double x) const noexcept;
+
+    std::size_t knots_ = 0;
+    // x[knots_], then a, b, c and d with one entry per interval each
+    std::vector<double> coefficients_;
+    // Set when the knots are close enough to an even grid for direct indexing
+    bool uniform_ = false;
+    double inverse_step_ = 0;
+    // Interior knots x[1..n-2] in Eytzinger order from index 1, and the
+    // interval ending at each one; both stay empty for uniform knots
+    std::vector<double> tree_;
+    std::vector<std::size_t> ranks_;
+  };
+
+} // namespace cpp_concept
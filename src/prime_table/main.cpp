@@ -0,0 +1,33 @@
+#include "foo/prime_table.hpp"
+
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <string>
+
+// Writes the primality bitmap mapped by cpp_concept::PrimeTable.
+//
+// Usage: prime-table <path> [limit]
+int main(int argc, char *argv[])
+{
+  if (argc < 2 || argc > 3)
+  {
+    std::cerr << "Usage: " << argv[0] << " <path> [limit]" << std::endl;
+    return 2;
+  }
+
+  try
+  {
+    const std::string path = argv[1];
+    const std::uint64_t limit = argc == 3 ? std::stoull(argv[2]) : cpp_concept::PrimeTable::max_limit;
+    cpp_concept::PrimeTable::write(path, limit);
+    std::cout << "Wrote primes below " << limit << " to " << path << std::endl;
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << e.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
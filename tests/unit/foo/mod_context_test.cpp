@@ -0,0 +1,263 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "foo/mod_context.hpp"
+
+using namespace cpp_concept;
+
+TEST(ModContextTest, Construct)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::uint64_t modulus;
+    } in;
+
+    struct Want
+    {
+      bool throws_exception;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"smallest modulus", /* in */ {2}, /* want */ {false}},
+      {"largest modulus", /* in */ {18446744073709551615ULL}, /* want */ {false}},
+      {"zero modulus", /* in */ {0}, /* want */ {true}},
+      {"modulus one", /* in */ {1}, /* want */ {true}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(ModContext{tc.in.modulus}, std::invalid_argument);
+    }
+    else
+    {
+      EXPECT_EQ(ModContext(tc.in.modulus).modulus(), tc.in.modulus);
+    }
+  }
+}
+
+TEST(ModContextTest, Scalar)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::uint64_t modulus;
+      std::uint64_t a;
+      std::uint64_t b;
+    } in;
+
+    struct Want
+    {
+      std::uint64_t reduced;
+      std::uint64_t sum;
+      std::uint64_t product;
+      std::uint64_t power;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"zero operands", /* in */ {998244353, 0, 0}, /* want */ {0, 0, 0, 1}},
+      {"NTT prime", /* in */ {998244353, 123456789, 987654321}, /* want */ {123456789, 112866757, 263684735, 730701112}},
+      {"sum wraps once", /* in */ {1000000007, 1000000006, 1000000006}, /* want */ {1000000006, 1000000005, 1, 1}},
+      {"even modulus", /* in */ {4294967296ULL, 123456789, 987654321}, /* want */ {123456789, 1111111110, 4227814277ULL, 3702236757ULL}},
+      {"boundary: largest 64-bit prime", /* in */ {18446744073709551557ULL, 18446744073709551556ULL, 2}, /* want */ {18446744073709551556ULL, 1, 18446744073709551555ULL, 1}},
+      {"boundary: sum past 2^64", /* in */ {18446744073709551615ULL, 18446744073709551614ULL, 18446744073709551614ULL}, /* want */ {18446744073709551614ULL, 18446744073709551613ULL, 1, 1}},
+      {"boundary: largest power of two", /* in */ {9223372036854775808ULL, 9223372036854775807ULL, 3}, /* want */ {9223372036854775807ULL, 2, 9223372036854775805ULL, 9223372036854775807ULL}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    const ModContext mod(tc.in.modulus);
+
+    // Act & Assert
+    EXPECT_EQ(mod.reduce(tc.in.a), tc.want.reduced);
+    EXPECT_EQ(mod.add(tc.in.a, tc.in.b), tc.want.sum);
+    EXPECT_EQ(mod.multiply(tc.in.a, tc.in.b), tc.want.product);
+    EXPECT_EQ(mod.power(tc.in.a, tc.in.b), tc.want.power);
+  }
+}
+
+TEST(ModContextTest, ScalarMatchesDivision)
+{
+  // Arrange
+  std::mt19937_64 engine(42);
+  const std::vector<std::uint64_t> moduli = {2, 3, 1000000007, 4294967291ULL, 4294967296ULL, 1ULL << 40,
+                                             18446744073709551557ULL, 18446744073709551615ULL};
+
+  for (const auto m : moduli)
+  {
+    SCOPED_TRACE(m);
+    const ModContext mod(m);
+
+    for (int i = 0; i < 1000; ++i)
+    {
+      const std::uint64_t a = engine();
+      const std::uint64_t b = engine();
+
+      // Act & Assert
+      EXPECT_EQ(mod.reduce(a), a % m);
+      EXPECT_EQ(mod.multiply(a, b), static_cast<std::uint64_t>(uint128_t{a} * b % m));
+    }
+  }
+}
+
+TEST(ModContextTest, Batch)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::uint64_t modulus;
+    } in;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"smallest modulus", /* in */ {2}},
+      {"small odd", /* in */ {3}},
+      {"NTT prime", /* in */ {998244353}},
+      {"boundary: largest 32-bit prime", /* in */ {4294967291ULL}},
+      {"boundary: largest 32-bit odd", /* in */ {4294967295ULL}},
+      {"even modulus below 2^32", /* in */ {2147483648ULL}},
+      {"first modulus past the lanes", /* in */ {4294967297ULL}},
+      {"largest 64-bit prime", /* in */ {18446744073709551557ULL}},
+  };
+
+  // A SIMD tail, and the extremes of the reduced range up front
+  std::mt19937_64 engine(7);
+  const std::size_t n = 1027;
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    const std::uint64_t m = tc.in.modulus;
+    const ModContext mod(m);
+    std::vector<std::uint64_t> a(n), b(n), c(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      a[i] = engine() % m;
+      b[i] = engine() % m;
+      c[i] = engine() % m;
+    }
+    a[0] = b[0] = c[0] = m - 1;
+    a[1] = 0;
+    std::vector<std::uint64_t> sum(n), product(n), fused(n), power(n);
+
+    // Act
+    mod.add(a, b, sum);
+    mod.multiply(a, b, product);
+    mod.multiply_add(a, b, c, fused);
+    mod.power(a, 1000000006, power);
+
+    // Assert
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      EXPECT_EQ(sum[i], static_cast<std::uint64_t>((uint128_t{a[i]} + b[i]) % m)) << "i = " << i;
+      EXPECT_EQ(product[i], static_cast<std::uint64_t>(uint128_t{a[i]} * b[i] % m)) << "i = " << i;
+      EXPECT_EQ(fused[i], static_cast<std::uint64_t>((uint128_t{a[i]} * b[i] + c[i]) % m)) << "i = " << i;
+      EXPECT_EQ(power[i], mod.power(a[i], 1000000006)) << "i = " << i;
+    }
+  }
+}
+
+TEST(ModContextTest, BatchPower)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::uint64_t modulus;
+      std::uint64_t exponent;
+    } in;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"exponent zero", /* in */ {998244353, 0}},
+      {"exponent one", /* in */ {998244353, 1}},
+      {"Fermat", /* in */ {998244353, 998244352}},
+      {"largest exponent", /* in */ {4294967291ULL, 18446744073709551615ULL}},
+      {"even modulus", /* in */ {1ULL << 31, 12345}},
+      {"64-bit modulus", /* in */ {18446744073709551557ULL, 18446744073709551556ULL}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    const ModContext mod(tc.in.modulus);
+    std::vector<std::uint64_t> bases(37);
+    for (std::size_t i = 0; i < bases.size(); ++i)
+    {
+      bases[i] = i;
+    }
+    std::vector<std::uint64_t> got(bases.size());
+
+    // Act
+    mod.power(bases, tc.in.exponent, got);
+
+    // Assert
+    for (std::size_t i = 0; i < bases.size(); ++i)
+    {
+      std::uint64_t want = 1;
+      for (std::uint64_t e = tc.in.exponent, x = bases[i]; e != 0; e >>= 1)
+      {
+        if (e & 1)
+        {
+          want = static_cast<std::uint64_t>(uint128_t{want} * x % tc.in.modulus);
+        }
+        x = static_cast<std::uint64_t>(uint128_t{x} * x % tc.in.modulus);
+      }
+      EXPECT_EQ(got[i], want) << "base " << bases[i];
+    }
+  }
+}
+
+TEST(ModContextTest, BatchSizeMismatch)
+{
+  // Arrange
+  const ModContext mod(998244353);
+  const std::vector<std::uint64_t> three(3), two(2);
+  std::vector<std::uint64_t> out(3);
+
+  // Act & Assert
+  EXPECT_THROW(mod.add(three, two, out), std::invalid_argument);
+  EXPECT_THROW(mod.multiply(two, three, out), std::invalid_argument);
+  EXPECT_THROW(mod.multiply_add(three, three, two, out), std::invalid_argument);
+  EXPECT_THROW(mod.power(two, 3, out), std::invalid_argument);
+  EXPECT_NO_THROW(mod.multiply_add(three, three, three, out));
+}
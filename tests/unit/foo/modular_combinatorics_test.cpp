@@ -0,0 +1,288 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "foo/modular_combinatorics.hpp"
+
+using namespace cpp_concept;
+
+TEST(ModularCombinatoricsTest, Construct)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::uint64_t p;
+      std::size_t limit;
+    } in;
+
+    struct Want
+    {
+      std::size_t limit;
+      bool throws_exception;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"smallest prime", /* in */ {2, 100}, /* want */ {1, false}},
+      {"limit below the modulus", /* in */ {1000000007, 1000}, /* want */ {1000, false}},
+      {"limit clamped to p - 1", /* in */ {13, 100}, /* want */ {12, false}},
+      {"largest 64-bit prime", /* in */ {18446744073709551557ULL, 10}, /* want */ {10, false}},
+      {"zero modulus", /* in */ {0, 10}, /* want */ {0, true}},
+      {"modulus one", /* in */ {1, 10}, /* want */ {0, true}},
+      {"even composite", /* in */ {4, 10}, /* want */ {0, true}},
+      {"odd composite", /* in */ {9, 10}, /* want */ {0, true}},
+      {"Carmichael number", /* in */ {561, 10}, /* want */ {0, true}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(ModularCombinatorics(tc.in.p, tc.in.limit), std::invalid_argument);
+      continue;
+    }
+
+    const ModularCombinatorics mod(tc.in.p, tc.in.limit);
+    EXPECT_EQ(mod.modulus(), tc.in.p);
+    EXPECT_EQ(mod.limit(), tc.want.limit);
+  }
+}
+
+TEST(ModularCombinatoricsTest, Factorial)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::uint64_t p;
+      std::size_t limit;
+      std::uint64_t n;
+    } in;
+
+    struct Want
+    {
+      std::uint64_t factorial;
+      bool throws_exception;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"factorial of zero", /* in */ {1000000007, 100, 0}, /* want */ {1, false}},
+      {"exact factorial", /* in */ {1000000007, 100, 12}, /* want */ {479001600, false}},
+      {"reduced factorial", /* in */ {1000000007, 100, 100}, /* want */ {437918130, false}},
+      {"Wilson's theorem", /* in */ {13, 12, 12}, /* want */ {12, false}},
+      {"factorial of p", /* in */ {13, 12, 13}, /* want */ {0, false}},
+      {"factorial past p", /* in */ {13, 5, 1000}, /* want */ {0, false}},
+      {"past the table but below p", /* in */ {13, 5, 6}, /* want */ {0, true}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    const ModularCombinatorics mod(tc.in.p, tc.in.limit);
+
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(mod.factorial(tc.in.n), std::out_of_range);
+      EXPECT_THROW(mod.inverse_factorial(tc.in.n), std::out_of_range);
+      continue;
+    }
+
+    EXPECT_EQ(mod.factorial(tc.in.n), tc.want.factorial);
+    for (std::uint64_t n = 1; n <= mod.limit(); ++n)
+    {
+      // Moduli below 2^32 keep the products within 64 bits
+      EXPECT_EQ(mod.factorial(n) * mod.inverse_factorial(n) % tc.in.p, 1U) << "n = " << n;
+      EXPECT_EQ(mod.inverse(n) * n % tc.in.p, 1U) << "n = " << n;
+    }
+    EXPECT_THROW(mod.inverse(0), std::out_of_range);
+  }
+}
+
+TEST(ModularCombinatoricsTest, Binomial)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::uint64_t p;
+      std::size_t limit;
+      std::uint64_t n;
+      std::uint64_t r;
+    } in;
+
+    struct Want
+    {
+      std::uint64_t binomial;
+      bool throws_exception;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"choose none", /* in */ {1000000007, 100, 10, 0}, /* want */ {1, false}},
+      {"choose all", /* in */ {1000000007, 100, 10, 10}, /* want */ {1, false}},
+      {"exact binomial", /* in */ {1000000007, 100, 10, 3}, /* want */ {120, false}},
+      {"reduced binomial", /* in */ {1000000007, 1000000, 1000000, 500000}, /* want */ {996692777, false}},
+      {"r greater than n", /* in */ {1000000007, 100, 3, 5}, /* want */ {0, false}},
+      {"r greater than n past the table", /* in */ {13, 12, 100, 101}, /* want */ {0, false}},
+      {"Lucas: digit of r exceeds digit of n", /* in */ {13, 12, 13, 1}, /* want */ {0, false}},
+      {"Lucas: several digits", /* in */ {13, 12, 1000000000000ULL, 3}, /* want */ {0, false}},
+      {"Lucas: large prime", /* in */ {1000003, 1000002, 123456789012345ULL, 98765432101ULL}, /* want */ {84802, false}},
+      {"base 2: bits of r within n", /* in */ {2, 1, 0b1011011, 0b1001010}, /* want */ {1, false}},
+      {"base 2: bit of r outside n", /* in */ {2, 1, 0b1011011, 0b0100000}, /* want */ {0, false}},
+      {"Lucas: digit of n past the table", /* in */ {13, 6, 20, 3}, /* want */ {0, true}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    const ModularCombinatorics mod(tc.in.p, tc.in.limit);
+
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(mod.binomial(tc.in.n, tc.in.r), std::out_of_range);
+    }
+    else
+    {
+      EXPECT_EQ(mod.binomial(tc.in.n, tc.in.r), tc.want.binomial);
+    }
+  }
+}
+
+TEST(ModularCombinatoricsTest, BinomialMatchesPascal)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::uint64_t p;
+      std::size_t limit;
+      std::uint64_t rows;
+    } in;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"table only", /* in */ {1000000007, 200, 200}},
+      {"table and Lucas over base 7", /* in */ {7, 6, 200}},
+      {"Lucas over base 2", /* in */ {2, 1, 200}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    const ModularCombinatorics mod(tc.in.p, tc.in.limit);
+    std::vector<std::uint64_t> row = {1};
+
+    for (std::uint64_t n = 0; n < tc.in.rows; ++n)
+    {
+      // Act
+      std::vector<std::uint64_t> got;
+      for (std::uint64_t r = 0; r <= n; ++r)
+      {
+        got.push_back(mod.binomial(n, r));
+      }
+
+      // Assert
+      EXPECT_EQ(got, row) << "n = " << n;
+
+      std::vector<std::uint64_t> next(row.size() + 1, 1);
+      for (std::size_t r = 1; r < row.size(); ++r)
+      {
+        next[r] = (row[r - 1] + row[r]) % tc.in.p;
+      }
+      row = std::move(next);
+    }
+  }
+}
+
+TEST(ModularCombinatoricsTest, BinomialBatch)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::vector<std::uint64_t> n;
+      std::vector<std::uint64_t> r;
+      std::size_t out_size;
+    } in;
+
+    struct Want
+    {
+      bool throws_invalid_argument;
+      bool throws_out_of_range;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"empty batch", /* in */ {{}, {}, 0}, /* want */ {false, false}},
+      {"table and Lucas", /* in */ {{10, 12, 1000, 169}, {3, 13, 27, 13}, 4}, /* want */ {false, false}},
+      {"mismatched sizes", /* in */ {{10, 12}, {3}, 2}, /* want */ {true, false}},
+      {"mismatched output", /* in */ {{10, 12}, {3, 4}, 1}, /* want */ {true, false}},
+      {"digit past the table", /* in */ {{10, 20}, {3, 3}, 2}, /* want */ {false, true}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    const ModularCombinatorics mod(13, 12);
+    const ModularCombinatorics partial(13, 6);
+    std::vector<std::uint64_t> got(tc.in.out_size);
+
+    // Act & Assert
+    if (tc.want.throws_invalid_argument)
+    {
+      EXPECT_THROW(mod.binomial(tc.in.n, tc.in.r, got), std::invalid_argument);
+      continue;
+    }
+    if (tc.want.throws_out_of_range)
+    {
+      EXPECT_THROW(partial.binomial(tc.in.n, tc.in.r, got), std::out_of_range);
+      continue;
+    }
+
+    mod.binomial(tc.in.n, tc.in.r, got);
+    for (std::size_t i = 0; i < got.size(); ++i)
+    {
+      EXPECT_EQ(got[i], mod.binomial(tc.in.n[i], tc.in.r[i]));
+    }
+  }
+}
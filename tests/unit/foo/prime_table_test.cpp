@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "foo/foo.hpp"
+#include "foo/prime_table.hpp"
+
+using namespace cpp_concept;
+
+namespace
+{
+
+  std::string scratch_path(const std::string &name)
+  {
+    // The pid keeps concurrent runs of the suite, such as ctest -j, apart
+    const std::string file = "prime_table_test_" + name + "_" + std::to_string(::getpid()) + ".bin";
+    return (std::filesystem::temp_directory_path() / file).string();
+  }
+
+} // namespace
+
+TEST(PrimeTableTest, IsPrime)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::uint64_t limit;
+      unsigned threads;
+    } in;
+
+    struct Want
+    {
+      bool throws_exception;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"empty table", /* in */ {0, 1}, /* want */ {false}},
+      {"limit inside the first byte", /* in */ {8, 1}, /* want */ {false}},
+      {"limit on a byte boundary", /* in */ {60, 1}, /* want */ {false}},
+      {"limit past a segment", /* in */ {1000003, 1}, /* want */ {false}},
+      {"several segments on four threads", /* in */ {20000000, 4}, /* want */ {false}},
+      {"limit past the 32-bit domain", /* in */ {PrimeTable::max_limit + 1, 1}, /* want */ {true}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+    const std::string path = scratch_path("is_prime");
+
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(PrimeTable::write(path, tc.in.limit, tc.in.threads), std::invalid_argument);
+      continue;
+    }
+
+    PrimeTable::write(path, tc.in.limit, tc.in.threads);
+    const PrimeTable table(path);
+    std::vector<std::uint64_t> got;
+    for (std::uint64_t n = 0; n < tc.in.limit; ++n)
+    {
+      if (table.is_prime(static_cast<std::uint32_t>(n)))
+      {
+        got.push_back(n);
+      }
+    }
+
+    EXPECT_EQ(table.limit(), tc.in.limit);
+    EXPECT_EQ(got, foo.primes_in(0, tc.in.limit));
+    EXPECT_THROW(table.is_prime(static_cast<std::uint32_t>(tc.in.limit)), std::out_of_range);
+    std::filesystem::remove(path);
+  }
+}
+
+TEST(PrimeTableTest, Open)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      bool exists;
+      std::string contents;
+    } in;
+
+    struct Want
+    {
+      bool throws_system_error;
+      bool throws_runtime_error;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"missing file", /* in */ {false, ""}, /* want */ {true, false}},
+      {"empty file", /* in */ {true, ""}, /* want */ {false, true}},
+      {"wrong magic", /* in */ {true, std::string(16, 'x')}, /* want */ {false, true}},
+      {"truncated bitmap", /* in */ {true, std::string("PRIME30\0\x40\0\0\0\0\0\0\0", 16)}, /* want */ {false, true}},
+      {"empty table", /* in */ {true, std::string("PRIME30\0\0\0\0\0\0\0\0\0", 16)}, /* want */ {false, false}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    const std::string path = scratch_path("open");
+    std::filesystem::remove(path);
+    if (tc.in.exists)
+    {
+      std::ofstream(path, std::ios::binary) << tc.in.contents;
+    }
+
+    // Act & Assert
+    if (tc.want.throws_system_error)
+    {
+      EXPECT_THROW(PrimeTable{path}, std::system_error);
+    }
+    else if (tc.want.throws_runtime_error)
+    {
+      EXPECT_THROW(PrimeTable{path}, std::runtime_error);
+    }
+    else
+    {
+      PrimeTable table(path);
+      PrimeTable moved(std::move(table));
+      EXPECT_EQ(moved.limit(), 0U);
+      EXPECT_THROW(moved.is_prime(0), std::out_of_range);
+    }
+    std::filesystem::remove(path);
+  }
+}
@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+
+#include <climits>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "foo/foo.hpp"
+#include "foo/range_max.hpp"
+
+using namespace cpp_concept;
+
+TEST(RangeMaxTest, Max)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::vector<int> values;
+      std::size_t first;
+      std::size_t last;
+    } in;
+
+    struct Want
+    {
+      int result;
+      bool throws_invalid_argument;
+      bool throws_out_of_range;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"single element", /* in */ {{42}, 0, 1}, /* want */ {42, false, false}},
+      {"whole sequence", /* in */ {{3, 1, 4, 1, 5, 9, 2, 6}, 0, 8}, /* want */ {9, false, false}},
+      {"prefix", /* in */ {{3, 1, 4, 1, 5, 9, 2, 6}, 0, 4}, /* want */ {4, false, false}},
+      {"suffix", /* in */ {{3, 1, 4, 1, 5, 9, 2, 6}, 6, 8}, /* want */ {6, false, false}},
+      {"negative numbers", /* in */ {{-5, -1, -3}, 0, 3}, /* want */ {-1, false, false}},
+      {"boundary: int limits", /* in */ {{INT_MIN, INT_MAX, INT_MIN}, 0, 3}, /* want */ {INT_MAX, false, false}},
+      {"empty range", /* in */ {{1, 2, 3}, 1, 1}, /* want */ {0, true, false}},
+      {"reversed range", /* in */ {{1, 2, 3}, 2, 1}, /* want */ {0, true, false}},
+      {"empty sequence", /* in */ {{}, 0, 0}, /* want */ {0, true, false}},
+      {"range past the end", /* in */ {{1, 2, 3}, 1, 4}, /* want */ {0, false, true}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    RangeMax index(tc.in.values);
+
+    // Act & Assert
+    if (tc.want.throws_invalid_argument)
+    {
+      EXPECT_THROW(index.max(tc.in.first, tc.in.last), std::invalid_argument);
+    }
+    else if (tc.want.throws_out_of_range)
+    {
+      EXPECT_THROW(index.max(tc.in.first, tc.in.last), std::out_of_range);
+    }
+    else
+    {
+      EXPECT_EQ(index.max(tc.in.first, tc.in.last), tc.want.result);
+    }
+  }
+}
+
+TEST(RangeMaxTest, MaxMatchesFindMax)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::size_t size;
+      int modulus;
+    } in;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"within one block", /* in */ {31, 1000}},
+      {"partial last block", /* in */ {97, 1000}},
+      {"many blocks", /* in */ {300, 1000}},
+      {"many ties", /* in */ {300, 3}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+    std::vector<int> values(tc.in.size);
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+      values[i] = static_cast<int>(static_cast<unsigned>(i) * 2654435761U % static_cast<unsigned>(tc.in.modulus));
+    }
+    RangeMax index(values);
+
+    // Act & Assert
+    for (std::size_t first = 0; first < values.size(); ++first)
+    {
+      for (std::size_t last = first + 1; last <= values.size(); ++last)
+      {
+        const auto want = foo.find_max(std::span<const int>(values).subspan(first, last - first));
+        ASSERT_EQ(index.max(first, last), want) << "range [" << first << ", " << last << ")";
+      }
+    }
+  }
+}
+
+TEST(RangeMaxTest, MaxBatch)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::vector<std::size_t> firsts;
+      std::vector<std::size_t> lasts;
+      std::size_t out_size;
+    } in;
+
+    struct Want
+    {
+      std::vector<int> result;
+      bool throws_exception;
+    } want;
+  };
+
+  const std::vector<int> values = {3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5};
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"no queries", /* in */ {{}, {}, 0}, /* want */ {{}, false}},
+      {"several queries", /* in */ {{0, 1, 6, 3}, {3, 5, 11, 4}, 4}, /* want */ {{4, 5, 6, 1}, false}},
+      {"mismatched output", /* in */ {{0, 1}, {3, 5}, 1}, /* want */ {{}, true}},
+      {"mismatched bounds", /* in */ {{0, 1}, {3}, 2}, /* want */ {{}, true}},
+      {"empty range", /* in */ {{0, 2}, {3, 2}, 2}, /* want */ {{}, true}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    RangeMax index(values);
+    std::vector<int> got(tc.in.out_size);
+
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(index.max(tc.in.firsts, tc.in.lasts, got), std::invalid_argument);
+    }
+    else
+    {
+      index.max(tc.in.firsts, tc.in.lasts, got);
+      EXPECT_EQ(got, tc.want.result);
+    }
+  }
+}
@@ -0,0 +1,223 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "foo/foo.hpp"
+#include "foo/sliding_window_max.hpp"
+
+using namespace cpp_concept;
+
+TEST(SlidingWindowMaxTest, Push)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::size_t window;
+      std::vector<int> samples;
+    } in;
+
+    struct Want
+    {
+      std::vector<int> result;
+      bool throws_exception;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"window of one", /* in */ {1, {3, 1, 4, 1, 5}}, /* want */ {{3, 1, 4, 1, 5}, false}},
+      {"maximum expires", /* in */ {3, {4, 1, 2, 0, 0}}, /* want */ {{4, 4, 4, 2, 2}, false}},
+      {"increasing stream", /* in */ {2, {1, 2, 3, 4}}, /* want */ {{1, 2, 3, 4}, false}},
+      {"decreasing stream", /* in */ {2, {4, 3, 2, 1}}, /* want */ {{4, 4, 3, 2}, false}},
+      {"duplicates", /* in */ {2, {5, 5, 5, 1, 1}}, /* want */ {{5, 5, 5, 5, 1}, false}},
+      {"window longer than stream", /* in */ {10, {2, 7, 1}}, /* want */ {{2, 7, 7}, false}},
+      {"non power of two window", /* in */ {3, {9, 0, 0, 0, 8, 0, 0, 0}}, /* want */ {{9, 9, 9, 0, 8, 8, 8, 0}, false}},
+      {"boundary: int limits", /* in */ {2, {INT_MIN, INT_MAX, INT_MIN, INT_MIN}},
+       /* want */ {{INT_MIN, INT_MAX, INT_MAX, INT_MIN}, false}},
+      {"empty window", /* in */ {0, {}}, /* want */ {{}, true}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(SlidingWindowMax{tc.in.window}, std::invalid_argument);
+    }
+    else
+    {
+      // Arrange
+      SlidingWindowMax window(tc.in.window);
+      std::vector<int> got;
+
+      // Act
+      for (auto sample : tc.in.samples)
+      {
+        got.push_back(window.push(sample));
+      }
+
+      // Assert
+      EXPECT_EQ(got, tc.want.result);
+      EXPECT_EQ(window.max(), tc.want.result.back());
+      EXPECT_EQ(window.size(), std::min(tc.in.window, tc.in.samples.size()));
+    }
+  }
+}
+
+TEST(SlidingWindowMaxTest, PushMatchesFindMax)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::size_t window;
+      int modulus;
+    } in;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"power of two window", /* in */ {16, 1000}},
+      {"odd window", /* in */ {37, 1000}},
+      {"many ties", /* in */ {37, 3}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    Foo foo;
+    SlidingWindowMax window(tc.in.window);
+    std::vector<int> samples(2000);
+    for (std::size_t i = 0; i < samples.size(); ++i)
+    {
+      samples[i] = static_cast<int>(static_cast<unsigned>(i) * 2654435761U % static_cast<unsigned>(tc.in.modulus));
+    }
+
+    // Act & Assert
+    for (std::size_t i = 0; i < samples.size(); ++i)
+    {
+      const std::size_t first = i + 1 >= tc.in.window ? i + 1 - tc.in.window : 0;
+      const auto want = foo.find_max(std::span<const int>(samples).subspan(first, i + 1 - first));
+      ASSERT_EQ(window.push(samples[i]), want) << "sample " << i;
+    }
+  }
+}
+
+TEST(SlidingWindowMaxTest, PushBatch)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::vector<int> samples;
+      std::size_t out_size;
+    } in;
+
+    struct Want
+    {
+      std::vector<int> result;
+      bool throws_exception;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"empty span", /* in */ {{}, 0}, /* want */ {{}, false}},
+      {"several samples", /* in */ {{4, 1, 2, 0, 0}, 5}, /* want */ {{4, 4, 4, 2, 2}, false}},
+      {"mismatched output", /* in */ {{4, 1}, 1}, /* want */ {{}, true}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    SlidingWindowMax window(3);
+    std::vector<int> got(tc.in.out_size);
+
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(window.push(tc.in.samples, got), std::invalid_argument);
+    }
+    else
+    {
+      window.push(tc.in.samples, got);
+      EXPECT_EQ(got, tc.want.result);
+    }
+  }
+}
+
+TEST(SlidingWindowMaxTest, Max)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::vector<int> samples;
+      bool clear;
+    } in;
+
+    struct Want
+    {
+      int result;
+      bool throws_exception;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"after samples", /* in */ {{1, 5, 2}, false}, /* want */ {5, false}},
+      {"no samples", /* in */ {{}, false}, /* want */ {0, true}},
+      {"after clear", /* in */ {{1, 5, 2}, true}, /* want */ {0, true}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    SlidingWindowMax window(4);
+    for (auto sample : tc.in.samples)
+    {
+      window.push(sample);
+    }
+    if (tc.in.clear)
+    {
+      window.clear();
+    }
+
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(window.max(), std::invalid_argument);
+    }
+    else
+    {
+      EXPECT_EQ(window.max(), tc.want.result);
+    }
+  }
+}
@@ -0,0 +1,252 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "foo/foo.hpp"
+#include "foo/spline.hpp"
+
+using namespace cpp_concept;
+
+TEST(SplineTest, Construct)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::vector<double> x;
+      std::vector<double> y;
+    } in;
+
+    struct Want
+    {
+      bool throws_exception;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"two knots", /* in */ {{0, 1}, {0, 1}}, /* want */ {false}},
+      {"uneven spacing", /* in */ {{-3, 0.5, 0.75, 10}, {1, 2, 3, 4}}, /* want */ {false}},
+      {"size mismatch", /* in */ {{0, 1, 2}, {0, 1}}, /* want */ {true}},
+      {"single knot", /* in */ {{0}, {0}}, /* want */ {true}},
+      {"no knots", /* in */ {{}, {}}, /* want */ {true}},
+      {"repeated knot", /* in */ {{0, 1, 1, 2}, {0, 1, 2, 3}}, /* want */ {true}},
+      {"decreasing knots", /* in */ {{2, 1, 0}, {0, 1, 2}}, /* want */ {true}},
+      {"NaN knot", /* in */ {{0, std::numeric_limits<double>::quiet_NaN(), 2}, {0, 1, 2}}, /* want */ {true}},
+  };
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Act & Assert
+    if (tc.want.throws_exception)
+    {
+      EXPECT_THROW(Spline(tc.in.x, tc.in.y), std::invalid_argument);
+      EXPECT_THROW(Spline(tc.in.x, tc.in.y, 0, 0), std::invalid_argument);
+    }
+    else
+    {
+      const Spline spline(tc.in.x, tc.in.y);
+      EXPECT_EQ(spline.size(), tc.in.x.size());
+      EXPECT_EQ(std::vector<double>(spline.knots().begin(), spline.knots().end()), tc.in.x);
+    }
+  }
+}
+
+TEST(SplineTest, Evaluate)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      bool clamped;
+      double x;
+    } in;
+
+    struct Want
+    {
+      double result;
+    } want;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"natural at first knot", /* in */ {false, 0}, /* want */ {0}},
+      {"natural at middle knot", /* in */ {false, 1}, /* want */ {1}},
+      {"natural at last knot", /* in */ {false, 2}, /* want */ {0}},
+      {"natural between knots", /* in */ {false, 0.5}, /* want */ {0.6875}},
+      {"natural symmetric", /* in */ {false, 1.5}, /* want */ {0.6875}},
+      {"natural extrapolated", /* in */ {false, -1}, /* want */ {-1}},
+      {"clamped between knots", /* in */ {true, 0.5}, /* want */ {0.5}},
+      {"clamped at middle knot", /* in */ {true, 1}, /* want */ {1}},
+      {"clamped extrapolated", /* in */ {true, 3}, /* want */ {5}},
+  };
+
+  const std::vector<double> x = {0, 1, 2};
+  const std::vector<double> y = {0, 1, 0};
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    const Spline spline = tc.in.clamped ? Spline(x, y, 0, 0) : Spline(x, y);
+
+    // Act
+    auto got = spline(tc.in.x);
+
+    // Assert
+    EXPECT_DOUBLE_EQ(got, tc.want.result);
+  }
+}
+
+TEST(SplineTest, TwoKnotsMatchFooSpline)
+{
+  // Arrange
+  Foo foo;
+  const std::vector<double> x = {-5, 5};
+  const std::vector<double> y = {-10, 10};
+  const Spline spline = foo.spline(x, y);
+
+  for (const double at : {-7.5, -5.0, 0.0, 2.5, 5.0, 15.0})
+  {
+    SCOPED_TRACE(at);
+
+    // Act & Assert
+    EXPECT_DOUBLE_EQ(spline(at), foo.spline(x[0], y[0], x[1], y[1], at));
+  }
+}
+
+TEST(SplineTest, ClampedReproducesCubic)
+{
+  // Arrange
+  auto cubic = [](double t)
+  {
+    return 2 * t * t * t - 3 * t * t + t - 4;
+  };
+  auto slope = [](double t)
+  {
+    return 6 * t * t - 6 * t + 1;
+  };
+  const std::vector<double> x = {-2, -1.25, 0, 0.1, 1.5, 3, 4};
+  std::vector<double> y(x.size());
+  for (std::size_t i = 0; i < x.size(); ++i)
+  {
+    y[i] = cubic(x[i]);
+  }
+  const Spline spline(x, y, slope(x.front()), slope(x.back()));
+
+  for (double at = -3; at <= 5; at += 0.125)
+  {
+    SCOPED_TRACE(at);
+
+    // Act & Assert
+    EXPECT_NEAR(spline(at), cubic(at), 1e-9);
+  }
+}
+
+TEST(SplineTest, KnotLookup)
+{
+  // In-Got-Want
+  struct Tests
+  {
+    std::string label;
+
+    struct In
+    {
+      std::size_t knots;
+      double jitter; // random offset from the grid, in steps
+      bool walk;     // random steps instead of a grid
+    } in;
+  };
+
+  // Table-Driven Testing
+  const std::vector<Tests> tests = {
+      {"two knots", /* in */ {2, 0, false}},
+      {"uniform, three knots", /* in */ {3, 0, false}},
+      {"uniform, full tree", /* in */ {9, 0, false}},
+      {"uniform, many knots", /* in */ {1000, 0, false}},
+      {"near-uniform", /* in */ {1000, 0.2, false}},
+      {"off the grid", /* in */ {1000, 0.45, false}},
+      {"random, three knots", /* in */ {3, 0, true}},
+      {"random, full tree", /* in */ {9, 0, true}},
+      {"random, partial tree", /* in */ {12, 0, true}},
+      {"random, many knots", /* in */ {1000, 0, true}},
+  };
+
+  std::mt19937_64 engine(42);
+  std::uniform_real_distribution<double> unit(0, 1);
+
+  for (const auto &tc : tests)
+  {
+    SCOPED_TRACE(tc.label);
+
+    // Arrange
+    std::vector<double> x(tc.in.knots), y(tc.in.knots);
+    for (std::size_t i = 0; i < x.size(); ++i)
+    {
+      const double grid = -3 + 0.1 * static_cast<double>(i);
+      x[i] = tc.in.walk ? (i == 0 ? -3 : x[i - 1] + 0.01 + unit(engine)) : grid + 0.1 * tc.in.jitter * (unit(engine) - 0.5);
+      y[i] = unit(engine);
+    }
+    const Spline spline(x, y);
+
+    // Act & Assert
+    for (std::size_t i = 0; i + 1 < x.size(); ++i)
+    {
+      // The cubic starting at a knot returns its value exactly, the one before it only nearly
+      EXPECT_EQ(spline(x[i]), y[i]) << "i = " << i;
+      EXPECT_NEAR(spline(std::nextafter(x[i + 1], x[i])), y[i + 1], 1e-9) << "i = " << i;
+    }
+    EXPECT_NEAR(spline(x.back()), y.back(), 1e-9);
+  }
+}
+
+TEST(SplineTest, Batch)
+{
+  // Arrange
+  const std::vector<double> x = {0, 0.5, 2, 2.25, 4, 7};
+  const std::vector<double> y = {1, -1, 3, 2, 0, 5};
+  const Spline spline(x, y);
+  std::vector<double> points;
+  for (double at = -1; at <= 8; at += 0.0625)
+  {
+    points.push_back(at);
+  }
+  std::vector<double> got(points.size());
+
+  // Act
+  spline.evaluate(points, got);
+
+  // Assert
+  for (std::size_t i = 0; i < points.size(); ++i)
+  {
+    EXPECT_EQ(got[i], spline(points[i])) << "x = " << points[i];
+  }
+}
+
+TEST(SplineTest, BatchSizeMismatch)
+{
+  // Arrange
+  const std::vector<double> x = {0, 1, 2};
+  const Spline spline(x, x);
+  std::vector<double> out(2);
+
+  // Act & Assert
+  EXPECT_THROW(spline.evaluate(x, out), std::invalid_argument);
+  EXPECT_NO_THROW(spline.evaluate(std::span(x).first(2), out));
+}
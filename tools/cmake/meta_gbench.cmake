@@ -0,0 +1,78 @@
+include_guard(GLOBAL)
+
+# Description:
+#   Creates or extends a Google Benchmark-based executable for micro-benchmarks.
+#
+# Arguments:
+#   Options
+#     WITH_MAIN   - Link the benchmark main library. If not set, the caller must provide a main() in SOURCES.
+#   One-Value
+#     TARGET      - Required: target name for add_executable.
+#     ENABLE      - Optional: Boolean flag to enable/disable benchmark (default: ON).
+#   Multi-value
+#     SOURCES     - Optional: source files are intentionally optional for incremental extensions of an already-defined benchmark target.
+#     LINK        - Optional: semicolon-separated list of additional libraries to link.
+#
+# Outputs:
+#   NONE
+#
+# Usage:
+#   meta_gbench([WITH_MAIN]
+#              TARGET <name>
+#              [ENABLE <bool>]
+#              SOURCES <src>...
+#              [LINK <lib>...])
+#
+# Example:
+#   meta_gbench(WITH_MAIN TARGET my_bench SOURCES foo_bench.cpp LINK my_lib)
+function(meta_gbench)
+    set(options WITH_MAIN)
+    set(one_value_args TARGET ENABLE)
+    set(multi_value_args SOURCES LINK)
+    cmake_parse_arguments(PARSE_ARGV 0 ARG "${options}" "${one_value_args}" "${multi_value_args}")
+
+    if(DEFINED ARG_UNPARSED_ARGUMENTS)
+        message(FATAL_ERROR "${CMAKE_CURRENT_FUNCTION}: Unknown arguments: ${ARG_UNPARSED_ARGUMENTS}.")
+    endif()
+
+    if(DEFINED ARG_ENABLE AND NOT ARG_ENABLE)
+        return()
+    endif()
+
+    if(NOT ARG_TARGET)
+        message(FATAL_ERROR "${CMAKE_CURRENT_FUNCTION}: 'TARGET' argument is required.")
+    endif()
+
+    # Find required packages (idempotent)
+    if(NOT TARGET benchmark::benchmark)
+        find_package(benchmark CONFIG REQUIRED)
+    endif()
+
+    # Create the executable once, without binding to a fixed source set
+    if(NOT TARGET "${ARG_TARGET}")
+        add_executable("${ARG_TARGET}")
+    endif()
+
+    # Any SOURCES passed in this or subsequent calls are appended incrementally
+    if(ARG_SOURCES)
+        target_sources("${ARG_TARGET}" PRIVATE ${ARG_SOURCES})
+    endif()
+
+    # Base benchmark dependency (idempotent)
+    target_link_libraries("${ARG_TARGET}" PRIVATE benchmark::benchmark)
+
+    # Optional benchmark main
+    if(ARG_WITH_MAIN)
+        if(TARGET benchmark::benchmark_main)
+            target_link_libraries("${ARG_TARGET}" PRIVATE benchmark::benchmark_main)
+        endif()
+        target_compile_definitions("${ARG_TARGET}" PRIVATE META_GBENCH_WITH_MAIN)
+    endif()
+
+    target_compile_features("${ARG_TARGET}" PRIVATE cxx_std_20)
+
+    # Propagate any extra link libs passed via LINK (idempotent)
+    if(ARG_LINK)
+        target_link_libraries("${ARG_TARGET}" PRIVATE ${ARG_LINK})
+    endif()
+endfunction()